@@ -1,9 +1,24 @@
 #include <nanobench.h>
 
+#include <atomic>
+#include <cstdlib>
 #include <fstream>
+#include <functional>
+#include <future>
 #include <iostream>
+#include <limits>
+#include <list>
 #include <map>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <random>
+#include <ranges>
+#include <string>
 #include <string_view>
+#include <thread>
+#include <vector>
 
 #include <rpp/rpp.hpp>
 #ifdef RPP_BUILD_RXCPP
@@ -19,6 +34,29 @@
     #define TEST_RXCPP(ACTION)
 #endif
 
+// counts heap allocations of current thread to check steady-state allocations of hot paths
+static thread_local size_t s_allocations_count{};
+
+void* operator new(std::size_t size)
+{
+    ++s_allocations_count;
+    if (void* ptr = std::malloc(size))
+        return ptr;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+template<typename Fn>
+void report_allocations(std::string_view name, Fn&& fn)
+{
+    fn(); // warm up caches
+    const auto before = s_allocations_count;
+    fn();
+    std::cout << name << ": " << s_allocations_count - before << " allocations per iteration" << std::endl;
+}
+
 char const* json() noexcept {
     return R"DELIM([
 {{#result}}        {
@@ -76,6 +114,30 @@ int main(int argc, char* argv[]) // NOLINT
                 }) | rxcpp::operators::subscribe<int>([](int){});
             });
         }
+
+        SECTION("Subscribe empty callbacks to dynamic observable")
+        {
+            const auto action = [&]()
+            {
+                rpp::source::create<int>([&](auto&& observer)
+                {
+                    observer.on_next(1);
+                    observer.on_completed();
+                }).as_dynamic().subscribe([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
+            };
+
+            report_allocations("create+as_dynamic+subscribe", action);
+            TEST_RPP(action);
+
+            TEST_RXCPP([&]()
+            {
+                rxcpp::observable<>::create<int>([&](auto&& observer)
+                {
+                    observer.on_next(1);
+                    observer.on_completed();
+                }).as_dynamic().subscribe([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
     };
 
     BENCHMARK("Sources")
@@ -106,6 +168,73 @@ int main(int argc, char* argv[]) // NOLINT
                 rxcpp::observable<>::iterate(vals, rxcpp::identity_current_thread()).subscribe([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
             });
         }
+        SECTION("from vector of 10k - create + subscribe + immediate")
+        {
+            std::vector<int> vals(10'000, 123);
+            TEST_RPP([&]()
+            {
+                rpp::source::from_iterable(vals, rpp::schedulers::immediate{}).subscribe([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+
+            TEST_RXCPP([&]()
+            {
+                rxcpp::observable<>::iterate(vals, rxcpp::identity_immediate()).subscribe([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
+        SECTION("from vector of 10k - create + subscribe + current_thread")
+        {
+            std::vector<int> vals(10'000, 123);
+            TEST_RPP([&]()
+            {
+                rpp::source::from_iterable(vals, rpp::schedulers::current_thread{}).subscribe([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+
+            TEST_RXCPP([&]()
+            {
+                rxcpp::observable<>::iterate(vals, rxcpp::identity_current_thread()).subscribe([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
+        SECTION("10k values of iota+filter+transform view - create + subscribe + current_thread")
+        {
+            auto view = std::views::iota(0, 20'000) | std::views::filter([](int v) { return v % 2 == 0; }) | std::views::transform([](int v) { return v * 3; });
+
+            bench.context("source", "rpp from_range").run([&]()
+            {
+                rpp::source::from_range(view, rpp::schedulers::current_thread{}).subscribe([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+
+            bench.context("source", "rpp materialized vector + from_iterable").run([&]()
+            {
+                std::vector<int> vals{};
+                for (const int v : view)
+                    vals.push_back(v);
+                rpp::source::from_iterable(std::move(vals), rpp::schedulers::current_thread{}).subscribe([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
+        SECTION("from std::list of 100k - create + subscribe + current_thread")
+        {
+            const std::list<int> vals(100'000, 123);
+            TEST_RPP([&]()
+            {
+                rpp::source::from_iterable(vals, rpp::schedulers::current_thread{}).subscribe([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+
+            TEST_RXCPP([&]()
+            {
+                rxcpp::observable<>::iterate(vals, rxcpp::identity_current_thread()).subscribe([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
+        SECTION("concat of std::list of 100k just(1 immediate) - create + subscribe")
+        {
+            std::list<decltype(rpp::source::just(rpp::schedulers::immediate{}, 1))> observables{};
+            for (size_t i = 0; i < 100'000; ++i)
+                observables.push_back(rpp::source::just(rpp::schedulers::immediate{}, 1));
+
+            TEST_RPP([&]()
+            {
+                rpp::source::concat(observables).subscribe([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
         SECTION("concat_as_source of just(1 immediate) create + subscribe")
         {
             TEST_RPP([&]()
@@ -118,6 +247,45 @@ int main(int argc, char* argv[]) // NOLINT
                 rxcpp::observable<>::just(rxcpp::observable<>::just(1, rxcpp::identity_immediate()), rxcpp::identity_immediate()) | rxcpp::operators::concat() | rxcpp::operators::subscribe<int>([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
             });
         }
+        SECTION("concat of 3 just(3 ints) on current_thread inside current_thread schedule: use_shared vs use_arena")
+        {
+            const auto action = [](const auto& memory_model)
+            {
+                using model = std::decay_t<decltype(memory_model)>;
+                rpp::schedulers::current_thread::create_worker().schedule([](const auto&)
+                {
+                    rpp::source::concat<model>(rpp::source::just<model>(1, 2, 3), rpp::source::just<model>(4, 5, 6), rpp::source::just<model>(7, 8, 9))
+                        .subscribe([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
+                    return rpp::schedulers::optional_duration{};
+                }, rpp::make_lambda_observer([](int){}));
+            };
+
+            bench.context("source", "rpp use_shared").run([&]()
+            {
+                action(rpp::memory_model::use_shared{});
+            });
+
+            std::array<std::byte, 16 * 1024>    buffer{};
+            std::pmr::monotonic_buffer_resource arena{buffer.data(), buffer.size()};
+            bench.context("source", "rpp use_arena").run([&]()
+            {
+                {
+                    const rpp::memory_model::arena_scope scope{arena};
+                    action(rpp::memory_model::use_arena{});
+                }
+                arena.release();
+            });
+
+            report_allocations("use_shared", [&]() { action(rpp::memory_model::use_shared{}); });
+            report_allocations("use_arena", [&]()
+            {
+                {
+                    const rpp::memory_model::arena_scope scope{arena};
+                    action(rpp::memory_model::use_arena{});
+                }
+                arena.release();
+            });
+        }
     };
 
     BENCHMARK("Schedulers")
@@ -177,8 +345,244 @@ int main(int argc, char* argv[]) // NOLINT
                                     });
                 });
         }
+        SECTION("current_thread scheduler create worker + schedule + 100 recursive schedules")
+        {
+            TEST_RPP([&]()
+                {
+                    const auto worker = rpp::schedulers::current_thread::create_worker();
+                    worker.schedule([&worker](const auto& obs)
+                                    {
+                                        for (size_t i = 0; i < 100; ++i)
+                                            worker.schedule([](const auto& v) { ankerl::nanobench::doNotOptimizeAway(v); return rpp::schedulers::optional_duration{}; }, obs);
+                                        return rpp::schedulers::optional_duration{};
+                                    }, rpp::make_lambda_observer([](int){ }).as_dynamic());
+                });
+        }
+        SECTION("run_loop scheduler create worker + schedule + dispatch")
+        {
+            rpp::schedulers::run_loop loop{};
+            TEST_RPP([&]()
+            {
+                loop.create_worker().schedule([](const auto& v){ ankerl::nanobench::doNotOptimizeAway(v); return rpp::schedulers::optional_duration{}; }, rpp::make_lambda_observer([](int){ }));
+                loop.dispatch();
+            });
+#ifdef RPP_BUILD_RXCPP
+            rxcpp::schedulers::run_loop rl{};
+#endif
+            TEST_RXCPP([&]()
+            {
+                rxcpp::observe_on_run_loop(rl).create_coordinator().get_worker().schedule([](const auto& v){ ankerl::nanobench::doNotOptimizeAway(v); });
+                rl.dispatch();
+            });
+        }
+        const auto bench_backend = [&]<typename Backend>(std::string_view backend_name)
+        {
+            for (const size_t count : {10'000, 100'000})
+            {
+                SECTION("schedulables_queue<" + std::string{backend_name} + "> emplace + pop " + std::to_string(count) + " schedulables with random delays")
+                {
+                    std::mt19937                          gen{42};
+                    std::uniform_int_distribution<int>    distribution{0, 1'000};
+                    std::vector<std::chrono::microseconds> delays(count);
+                    for (auto& delay : delays)
+                        delay = std::chrono::microseconds{distribution(gen)};
+
+                    const auto now = rpp::schedulers::clock_type::now();
+                    TEST_RPP([&]()
+                    {
+                        rpp::schedulers::details::schedulables_queue<Backend> queue{};
+                        for (const auto& delay : delays)
+                            queue.emplace(now + delay, [](const auto& v){ ankerl::nanobench::doNotOptimizeAway(v); return rpp::schedulers::optional_duration{}; }, rpp::make_lambda_observer([](int){ }));
+
+                        while (!queue.is_empty())
+                            (*queue.pop())();
+                    });
+                }
+            }
+        };
+        bench_backend.operator()<rpp::schedulers::details::d_ary_heap<4>>("d_ary_heap<4>");
+        bench_backend.operator()<rpp::schedulers::details::timing_wheel<>>("timing_wheel");
+
+        SECTION("100k timers with delays up to 10s, 99% cancelled before time_point")
+        {
+            constexpr size_t                       count = 100'000;
+            std::mt19937                           gen{42};
+            std::uniform_int_distribution<int>     distribution{0, 10'000};
+            std::vector<std::chrono::milliseconds> delays(count);
+            for (auto& delay : delays)
+                delay = std::chrono::milliseconds{distribution(gen)};
+
+            const auto now     = rpp::schedulers::clock_type::now();
+            const auto make    = [&](size_t i, const std::vector<char>& cancelled)
+            {
+                auto fn  = [&cancelled, i](const auto& v) { if (!cancelled[i]) ankerl::nanobench::doNotOptimizeAway(v); return rpp::schedulers::optional_duration{}; };
+                auto obs = rpp::make_lambda_observer([](int){ });
+                return rpp::schedulers::details::make_schedulable<decltype(fn), decltype(obs)>(now + delays[i], std::move(fn), std::move(obs));
+            };
+
+            // d_ary_heap keeps cancelled timers till their time_point
+            bench.context("source", "rpp d_ary_heap<4> lazy cancellation").run([&]()
+            {
+                std::vector<char>                          cancelled(count);
+                rpp::schedulers::details::d_ary_heap<4> heap{};
+                for (size_t i = 0; i < count; ++i)
+                    heap.push(make(i, cancelled));
+                for (size_t i = 0; i < count; ++i)
+                    cancelled[i] = i % 100 != 0;
+
+                while (!heap.is_empty())
+                    (*heap.pop())();
+            });
+
+            // timing_wheel removes cancelled timers immediately
+            bench.context("source", "rpp timing_wheel eager cancellation").run([&]()
+            {
+                using wheel = rpp::schedulers::details::timing_wheel<>;
+
+                std::vector<char>                                 cancelled(count);
+                std::unique_ptr<wheel::group[]>                   groups{new wheel::group[count]};
+                std::vector<rpp::schedulers::details::schedulable_ptr> erased{};
+                wheel                                             timers{};
+                for (size_t i = 0; i < count; ++i)
+                    timers.push(make(i, cancelled), &groups[i]);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    if (i % 100 != 0)
+                        timers.erase(groups[i], erased);
+                }
+                erased.clear();
+
+                while (!timers.is_empty())
+                    (*timers.pop())();
+            });
+        }
+        for (const size_t producers_count : {1, 2, 4, 8, 16})
+        {
+            SECTION("new_thread worker: " + std::to_string(producers_count) + " producer threads schedule 16000 schedulables in total")
+            {
+                constexpr size_t total  = 16'000;
+                const auto       worker = rpp::schedulers::new_thread::create_worker();
+                TEST_RPP([&]()
+                {
+                    std::atomic_size_t remaining{total};
+                    std::promise<void> done{};
+
+                    std::vector<std::thread> producers{};
+                    for (size_t p = 0; p < producers_count; ++p)
+                    {
+                        producers.emplace_back([&]
+                        {
+                            for (size_t i = 0; i < total / producers_count; ++i)
+                            {
+                                worker.schedule([&remaining, &done](const auto&)
+                                {
+                                    if (--remaining == 0)
+                                        done.set_value();
+                                    return rpp::schedulers::optional_duration{};
+                                }, rpp::make_lambda_observer([](int){ }));
+                            }
+                        });
+                    }
+                    for (auto& t : producers)
+                        t.join();
+                    done.get_future().wait();
+                });
+            }
+        }
+        SECTION("virtual_time: 100 periodic timers x 3600 simulated seconds")
+        {
+            TEST_RPP([&]()
+            {
+                rpp::schedulers::virtual_time scheduler{};
+                const auto                    worker = scheduler.create_worker();
+                for (size_t i = 0; i < 100; ++i)
+                {
+                    worker.schedule(std::chrono::milliseconds{i}, [](const auto& v) -> rpp::schedulers::optional_duration
+                    {
+                        ankerl::nanobench::doNotOptimizeAway(v);
+                        return std::chrono::seconds{1};
+                    }, rpp::make_lambda_observer([](int){ }));
+                }
+                scheduler.advance_by(std::chrono::hours{1});
+            });
+        }
+        SECTION("from_iterable of 100 ints on current_thread inside current_thread schedule")
+        {
+            std::array<int, 100> vals{};
+            const auto           action = [&]()
+            {
+                rpp::schedulers::current_thread::create_worker().schedule([&vals](const auto&)
+                {
+                    rpp::source::from_iterable(vals, rpp::schedulers::current_thread{}).subscribe([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
+                    return rpp::schedulers::optional_duration{};
+                }, rpp::make_lambda_observer([](int){ }));
+            };
+
+            report_allocations("from_iterable of 100 ints on current_thread inside current_thread schedule", action);
+            TEST_RPP(action);
+        }
+        for (size_t threads = 1; threads <= std::max(std::thread::hardware_concurrency(), 1u); threads *= 2)
+        {
+            SECTION("thread_pool with " + std::to_string(threads) + " threads: 16 workers x 1000 schedulables")
+            {
+                rpp::schedulers::thread_pool pool{threads};
+                TEST_RPP([&]()
+                {
+                    constexpr size_t   workers_count = 16;
+                    std::atomic_size_t remaining{workers_count};
+                    std::promise<void> done{};
+                    for (size_t i = 0; i < workers_count; ++i)
+                    {
+                        pool.create_worker().schedule([&remaining, &done, counter = size_t{}](const auto&) mutable -> rpp::schedulers::optional_duration
+                        {
+                            for (size_t j = 0; j < 100; ++j)
+                                ankerl::nanobench::doNotOptimizeAway(j);
+
+                            if (++counter < 1000)
+                                return rpp::schedulers::duration{};
+                            if (--remaining == 0)
+                                done.set_value();
+                            return std::nullopt;
+                        }, rpp::make_lambda_observer([](int){ }));
+                    }
+                    done.get_future().wait();
+                });
+            }
+        }
     }
 
+    BENCHMARK("Disposables")
+    {
+        SECTION("8 threads add 2000 children each to one disposable, every second child is disposed early")
+        {
+            constexpr size_t threads_count       = 8;
+            constexpr size_t children_per_thread = 2'000;
+            TEST_RPP([&]()
+            {
+                const auto parent = std::make_shared<rpp::base_disposable>();
+
+                std::vector<std::thread> threads{};
+                for (size_t t = 0; t < threads_count; ++t)
+                {
+                    threads.emplace_back([&parent]
+                    {
+                        for (size_t i = 0; i < children_per_thread; ++i)
+                        {
+                            auto child = std::make_shared<rpp::base_disposable>();
+                            parent->add(child);
+                            if (i % 2)
+                                child->dispose();
+                        }
+                    });
+                }
+                for (auto& t : threads)
+                    t.join();
+
+                parent->dispose();
+            });
+        }
+    };
+
     BENCHMARK("Conditional Operators")
     {
         SECTION("create+take_while(false)+subscribe")
@@ -217,6 +621,253 @@ int main(int argc, char* argv[]) // NOLINT
                     | rxcpp::operators::subscribe<int>([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
             });
         }
+        SECTION("create(10M values)+10 x map(v+1)+subscribe")
+        {
+            const auto bench_chain = [&]<bool Nothrow>(const std::string& source)
+            {
+                const auto fn = [](int v) noexcept(Nothrow) { return v + 1; };
+                bench.context("source", source).run([&]()
+                {
+                    rpp::source::create<int>([](const auto& obs)
+                        {
+                            for (int i = 0; i < 10'000'000; ++i)
+                                obs.on_next(i);
+                        })
+                        | rpp::operators::map(fn) | rpp::operators::map(fn) | rpp::operators::map(fn) | rpp::operators::map(fn) | rpp::operators::map(fn)
+                        | rpp::operators::map(fn) | rpp::operators::map(fn) | rpp::operators::map(fn) | rpp::operators::map(fn) | rpp::operators::map(fn)
+                        | rpp::operators::subscribe([](int v) noexcept(Nothrow) { ankerl::nanobench::doNotOptimizeAway(v); });
+                });
+            };
+            bench_chain.operator()<true>("rpp noexcept callbacks");
+            bench_chain.operator()<false>("rpp potentially throwing callbacks");
+        }
+        SECTION("create(1000 values)+8 stages of map/filter/take_while+subscribe")
+        {
+            const auto source = rpp::source::create<int>([](const auto& obs)
+            {
+                for (int i = 0; i < 1000; ++i)
+                    obs.on_next(i);
+                obs.on_completed();
+            });
+            const auto add_one     = rpp::operators::map([](int v) { return v + 1; });
+            const auto positive    = rpp::operators::filter([](int v) { return v > 0; });
+            const auto not_too_big = rpp::operators::take_while([](int v) { return v < 10'000; });
+
+            // operator| fuses consecutive stages into one observer
+            bench.context("source", "rpp fused").run([&]()
+            {
+                int sum{};
+                source | add_one | positive | add_one | not_too_big | add_one | positive | add_one | add_one
+                       | rpp::operators::subscribe([&sum](int v) { sum += v; });
+                ankerl::nanobench::doNotOptimizeAway(sum);
+            });
+
+            // direct application of operators keeps one observer per operator
+            bench.context("source", "rpp unfused").run([&]()
+            {
+                int sum{};
+                add_one(add_one(positive(add_one(not_too_big(add_one(positive(add_one(source))))))))
+                    | rpp::operators::subscribe([&sum](int v) { sum += v; });
+                ankerl::nanobench::doNotOptimizeAway(sum);
+            });
+        }
+        SECTION("100k inner observables (one per source value): flat_map vs map+merge")
+        {
+            const auto bench_inner_churn = [&](const std::string& inner_name, const auto& to_inner)
+            {
+                const auto flat_map = [&](size_t max_concurrency)
+                {
+                    rpp::source::range(0, 100'000, rpp::schedulers::immediate{})
+                        | rpp::operators::flat_map(to_inner, max_concurrency)
+                        | rpp::operators::subscribe([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
+                };
+                const auto unlimited_flat_map = [&]() { flat_map(std::numeric_limits<size_t>::max()); };
+                const auto limited_flat_map   = [&]() { flat_map(4); };
+                const auto map_merge          = [&]()
+                {
+                    rpp::source::range(0, 100'000, rpp::schedulers::immediate{})
+                        | rpp::operators::map(to_inner)
+                        | rpp::operators::merge()
+                        | rpp::operators::subscribe([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
+                };
+
+                report_allocations("flat_map of " + inner_name, unlimited_flat_map);
+                report_allocations("flat_map(max_concurrency=4) of " + inner_name, limited_flat_map);
+                report_allocations("map+merge of " + inner_name, map_merge);
+                bench.context("source", "rpp flat_map of " + inner_name).run(unlimited_flat_map);
+                bench.context("source", "rpp flat_map(max_concurrency=4) of " + inner_name).run(limited_flat_map);
+                bench.context("source", "rpp map+merge of " + inner_name).run(map_merge);
+            };
+
+            bench_inner_churn("just(v)", [](int v) { return rpp::source::just(rpp::schedulers::immediate{}, v); });
+
+            // inner observable provides own disposable to cancel it, like subscription to some resource
+            bench_inner_churn("create(set_upstream+v)", [](int v)
+            {
+                return rpp::source::create<int>([v](auto&& obs)
+                {
+                    obs.set_upstream(rpp::disposable_wrapper{std::make_shared<rpp::base_disposable>()});
+                    obs.on_next(v);
+                    obs.on_completed();
+                });
+            });
+
+            TEST_RXCPP([&]()
+            {
+                rxcpp::observable<>::range(0, 99'999)
+                    | rxcpp::operators::flat_map([](int v) { return rxcpp::observable<>::just(v); })
+                    | rxcpp::operators::subscribe<int>([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
+        SECTION("1M values through concat_map(just(v))")
+        {
+            const auto concat_map = [&]()
+            {
+                rpp::source::range(0, 1'000'000, rpp::schedulers::immediate{})
+                    | rpp::operators::concat_map([](int v) { return rpp::source::just(rpp::schedulers::immediate{}, v); })
+                    | rpp::operators::subscribe([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
+            };
+            const auto flat_map = [&]()
+            {
+                rpp::source::range(0, 1'000'000, rpp::schedulers::immediate{})
+                    | rpp::operators::flat_map([](int v) { return rpp::source::just(rpp::schedulers::immediate{}, v); }, 1)
+                    | rpp::operators::subscribe([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
+            };
+            // first inner observable completes only after source, so all other values wait in queue
+            const auto buffered_concat_map = [&]()
+            {
+                std::optional<rpp::dynamic_observer<int>> first{};
+                rpp::source::create<int>([&first](const auto& obs)
+                {
+                    for (int i = 0; i < 1'000'000; ++i)
+                        obs.on_next(i);
+                    first->on_completed();
+                    obs.on_completed();
+                })
+                    | rpp::operators::concat_map([&first](int v)
+                    {
+                        return rpp::source::create<int>([&first, v](auto&& obs)
+                        {
+                            obs.on_next(v);
+                            if (v == 0)
+                                first.emplace(std::forward<decltype(obs)>(obs).as_dynamic());
+                            else
+                                obs.on_completed();
+                        });
+                    })
+                    | rpp::operators::subscribe([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
+            };
+
+            report_allocations("concat_map of just(v)", concat_map);
+            report_allocations("flat_map(max_concurrency=1) of just(v)", flat_map);
+            report_allocations("concat_map with buffered values", buffered_concat_map);
+            bench.context("source", "rpp concat_map").run(concat_map);
+            bench.context("source", "rpp flat_map(max_concurrency=1)").run(flat_map);
+            bench.context("source", "rpp concat_map with buffered values").run(buffered_concat_map);
+
+            TEST_RXCPP([&]()
+            {
+                rxcpp::observable<>::range(0, 999'999)
+                    | rxcpp::operators::concat_map([](int v) { return rxcpp::observable<>::just(v); })
+                    | rxcpp::operators::subscribe<int>([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
+    };
+
+    BENCHMARK("Batches")
+    {
+        SECTION("1M ints through map(v*2)+filter(v%3)+map(v+1)+subscribe")
+        {
+            std::vector<int> values(1'000'000);
+            for (size_t i = 0; i < values.size(); ++i)
+                values[i] = static_cast<int>(i);
+
+            const auto run = [&](const auto& source)
+            {
+                long long sum{};
+                source | rpp::operators::map([](int v) { return v * 2; })
+                       | rpp::operators::filter([](int v) { return v % 3 != 0; })
+                       | rpp::operators::map([](int v) { return v + 1; })
+                       | rpp::operators::subscribe([&sum](int v) { sum += v; });
+                ankerl::nanobench::doNotOptimizeAway(sum);
+            };
+
+            bench.context("source", "rpp on_next per value").run([&]()
+            {
+                run(rpp::source::create<int>([&values](const auto& obs)
+                {
+                    for (const auto v : values)
+                        obs.on_next(v);
+                    obs.on_completed();
+                }));
+            });
+
+            bench.context("source", "rpp on_next_batch").run([&]()
+            {
+                run(rpp::source::create<int>([&values](const auto& obs)
+                {
+                    obs.on_next_batch(values);
+                    obs.on_completed();
+                }));
+            });
+        }
+        SECTION("1M ints through map(v*2)+subscribe dynamic_observer")
+        {
+            std::vector<int> values(1'000'000);
+            for (size_t i = 0; i < values.size(); ++i)
+                values[i] = static_cast<int>(i);
+
+            const auto run = [&](const auto& source)
+            {
+                long long sum{};
+                (source | rpp::operators::map([](int v) { return v * 2; }))
+                    .subscribe(rpp::make_lambda_observer([&sum](int v) { sum += v; }).as_dynamic());
+                ankerl::nanobench::doNotOptimizeAway(sum);
+            };
+
+            bench.context("source", "rpp on_next per value").run([&]()
+            {
+                run(rpp::source::create<int>([&values](const auto& obs)
+                {
+                    for (const auto v : values)
+                        obs.on_next(v);
+                    obs.on_completed();
+                }));
+            });
+
+            bench.context("source", "rpp on_next_batch").run([&]()
+            {
+                run(rpp::source::create<int>([&values](const auto& obs)
+                {
+                    obs.on_next_batch(values);
+                    obs.on_completed();
+                }));
+            });
+        }
+        SECTION("1M ints through map(v*2)+filter(v%3)+subscribe: range vs from_iterable of vector")
+        {
+            const auto run = [](const auto& source)
+            {
+                long long sum{};
+                source | rpp::operators::map([](int v) { return v * 2; })
+                       | rpp::operators::filter([](int v) { return v % 3 != 0; })
+                       | rpp::operators::subscribe([&sum](int v) { sum += v; });
+                ankerl::nanobench::doNotOptimizeAway(sum);
+            };
+
+            bench.context("source", "rpp range").run([&]()
+            {
+                run(rpp::source::range(0, 1'000'000, rpp::schedulers::immediate{}));
+            });
+
+            bench.context("source", "rpp from_iterable of vector").run([&]()
+            {
+                std::vector<int> values(1'000'000);
+                for (size_t i = 0; i < values.size(); ++i)
+                    values[i] = static_cast<int>(i);
+                run(rpp::source::from_iterable(std::move(values), rpp::schedulers::immediate{}));
+            });
+        }
     };
 
     BENCHMARK("Filtering Operators")
@@ -255,6 +906,183 @@ int main(int argc, char* argv[]) // NOLINT
         }
     };
 
+    BENCHMARK("Combining Operators")
+    {
+        for (const size_t producers_count : {2, 4, 8, 16})
+        {
+            SECTION("merge: " + std::to_string(producers_count) + " producer threads emit 160000 values in total")
+            {
+                const size_t per_producer = 160'000 / producers_count;
+                // each producer emits its values from own thread via observer saved during subscription
+                const auto run_producers = [&](const std::vector<std::function<void(int)>>& emitters)
+                {
+                    std::vector<std::thread> producers{};
+                    for (const auto& emit : emitters)
+                    {
+                        producers.emplace_back([&emit, per_producer]
+                        {
+                            for (size_t i = 0; i < per_producer; ++i)
+                                emit(static_cast<int>(i));
+                        });
+                    }
+                    for (auto& t : producers)
+                        t.join();
+                };
+
+                bench.context("source", "rpp merge").run([&]()
+                {
+                    std::vector<rpp::dynamic_observer<int>>   observers{};
+                    std::vector<rpp::dynamic_observable<int>> observables{};
+                    for (size_t p = 0; p < producers_count; ++p)
+                        observables.push_back(rpp::source::create<int>([&observers](auto&& obs){ observers.push_back(std::forward<decltype(obs)>(obs).as_dynamic()); }).as_dynamic());
+
+                    rpp::source::from_iterable(observables, rpp::schedulers::immediate{})
+                        | rpp::operators::merge()
+                        | rpp::operators::subscribe([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
+
+                    std::vector<std::function<void(int)>> emitters{};
+                    for (const auto& obs : observers)
+                        emitters.emplace_back([&obs](int v){ obs.on_next(v); });
+                    run_producers(emitters);
+                });
+
+                bench.context("source", "mutex around observer").run([&]()
+                {
+                    std::mutex mutex{};
+                    const auto observer = rpp::make_lambda_observer([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
+
+                    std::vector<std::function<void(int)>> emitters(producers_count, [&](int v)
+                    {
+                        std::lock_guard lock{mutex};
+                        observer.on_next(v);
+                    });
+                    run_producers(emitters);
+                });
+            }
+        }
+    };
+
+    BENCHMARK("Utility Operators")
+    {
+        SECTION("just(1 immediate)+repeat(1M)+subscribe")
+        {
+            TEST_RPP([&]()
+            {
+                rpp::source::just(rpp::schedulers::immediate{}, 1)
+                    | rpp::operators::repeat(1'000'000)
+                    | rpp::operators::subscribe([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
+        SECTION("100k values by bursts of 16 dispatched via run_loop: observe_on vs schedule per value")
+        {
+            rpp::schedulers::run_loop loop{};
+            // source emits burst of values, then loop dispatches everything scheduled so far
+            const auto emit_by_bursts = [&loop](const auto& obs)
+            {
+                for (int i = 0; i < 100'000; i += 16)
+                {
+                    for (int j = i; j < i + 16; ++j)
+                        obs.on_next(j);
+                    while (loop.dispatch_if_ready()) {}
+                }
+                obs.on_completed();
+                while (loop.dispatch_if_ready()) {}
+            };
+
+            const auto observe_on = [&]()
+            {
+                rpp::source::create<int>(emit_by_bursts)
+                    | rpp::operators::observe_on(loop)
+                    | rpp::operators::subscribe([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
+            };
+            const auto schedule_per_value = [&]()
+            {
+                const auto worker     = loop.create_worker();
+                const auto downstream = rpp::make_lambda_observer([](int v){ ankerl::nanobench::doNotOptimizeAway(v); }).as_dynamic();
+                rpp::source::create<int>(emit_by_bursts)
+                    | rpp::operators::subscribe([&](int v)
+                                                {
+                                                    worker.schedule([v](const auto& obs)
+                                                    {
+                                                        obs.on_next(v);
+                                                        return rpp::schedulers::optional_duration{};
+                                                    }, downstream);
+                                                });
+            };
+
+            report_allocations("observe_on", observe_on);
+            report_allocations("schedule per value", schedule_per_value);
+            bench.context("source", "rpp observe_on").run(observe_on);
+            bench.context("source", "rpp schedule per value").run(schedule_per_value);
+        }
+        SECTION("100k values from producer thread to new_thread consumer: observe_on vs schedule per value")
+        {
+            const auto emit = [](const auto& obs)
+            {
+                for (int i = 0; i < 100'000; ++i)
+                    obs.on_next(i);
+                obs.on_completed();
+            };
+
+            const auto observe_on = [&]()
+            {
+                std::promise<void> completed{};
+                rpp::source::create<int>(emit)
+                    | rpp::operators::observe_on(rpp::schedulers::new_thread{})
+                    | rpp::operators::subscribe([](int v){ ankerl::nanobench::doNotOptimizeAway(v); },
+                                                [](const std::exception_ptr&){},
+                                                [&completed]{ completed.set_value(); });
+                completed.get_future().wait();
+            };
+            const auto schedule_per_value = [&]()
+            {
+                std::promise<void> completed{};
+                const auto worker     = rpp::schedulers::new_thread::create_worker();
+                const auto downstream = rpp::make_lambda_observer([](int v){ ankerl::nanobench::doNotOptimizeAway(v); },
+                                                                  [](const std::exception_ptr&){},
+                                                                  [&completed]{ completed.set_value(); }).as_dynamic();
+                rpp::source::create<int>(emit)
+                    | rpp::operators::subscribe([&](int v)
+                                                {
+                                                    worker.schedule([v](const auto& obs)
+                                                    {
+                                                        obs.on_next(v);
+                                                        return rpp::schedulers::optional_duration{};
+                                                    }, downstream);
+                                                },
+                                                [](const std::exception_ptr&){},
+                                                [&]
+                                                {
+                                                    worker.schedule([](const auto& obs)
+                                                    {
+                                                        obs.on_completed();
+                                                        return rpp::schedulers::optional_duration{};
+                                                    }, downstream);
+                                                });
+                completed.get_future().wait();
+            };
+
+            bench.context("source", "rpp observe_on").run(observe_on);
+            bench.context("source", "rpp schedule per value").run(schedule_per_value);
+        }
+        SECTION("create+subscribe_on(immediate)+subscribe")
+        {
+            TEST_RPP([&]()
+            {
+                rpp::source::create<int>([](const auto& obs){ obs.on_next(1); })
+                    | rpp::operators::subscribe_on(rpp::schedulers::immediate{})
+                    | rpp::operators::subscribe([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+
+            TEST_RXCPP([&]()
+            {
+                rxcpp::observable<>::create<int>([](const auto& obs){obs.on_next(1);})
+                    | rxcpp::operators::subscribe_on(rxcpp::identity_immediate())
+                    | rxcpp::operators::subscribe<int>([](int v){ ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
+    };
+
     if (argc > 1) {
         std::ofstream of{argv[1]};
         bench.render(json(), of);
@@ -0,0 +1,19 @@
+#include <rpp/rpp.hpp>
+#include <exception>
+#include <iostream>
+
+/**
+ * @example concat_map.cpp
+ **/
+int main()
+{
+    //! [concat_map]
+    rpp::source::just(1, 2, 3)
+            | rpp::operators::concat_map([](int v) { return rpp::source::just(v, v * 10); })
+            | rpp::operators::subscribe([](int v) { std::cout << v << " "; },
+                                        [](const std::exception_ptr&){},
+                                        []() { std::cout << "completed" << std::endl; });
+    // Output: 1 10 2 20 3 30 completed
+    //! [concat_map]
+    return 0;
+}
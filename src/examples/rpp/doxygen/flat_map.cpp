@@ -0,0 +1,28 @@
+#include <rpp/rpp.hpp>
+#include <exception>
+#include <iostream>
+
+/**
+ * @example flat_map.cpp
+ **/
+int main()
+{
+    //! [flat_map]
+    rpp::source::just(1, 2, 3)
+            | rpp::operators::flat_map([](int v) { return rpp::source::just(v, v * 10); })
+            | rpp::operators::subscribe([](int v) { std::cout << v << " "; },
+                                        [](const std::exception_ptr&){},
+                                        []() { std::cout << "completed" << std::endl; });
+    // Output: 1 10 2 20 3 30 completed
+    //! [flat_map]
+
+    //! [flat_map with max_concurrency]
+    rpp::source::range(1, 3)
+            | rpp::operators::flat_map([](int v) { return rpp::source::range(v * 10, 2); }, 1)
+            | rpp::operators::subscribe([](int v) { std::cout << v << " "; },
+                                        [](const std::exception_ptr&){},
+                                        []() { std::cout << "completed" << std::endl; });
+    // Output: 10 11 20 21 30 31 completed
+    //! [flat_map with max_concurrency]
+    return 0;
+}
@@ -1,6 +1,7 @@
 #include <rpp/rpp.hpp>
 
 #include <iostream>
+#include <ranges>
 
 /**
  * \example from.cpp
@@ -30,6 +31,15 @@ int main() // NOLINT
         //! [from_iterable with scheduler]
     }
 
+    {
+        //! [from_range]
+        rpp::source::from_range(std::views::iota(1) | std::views::filter([](int v) { return v % 2 == 0; }))
+            | rpp::operators::take(3)
+            | rpp::operators::subscribe([](int v) {std::cout << v << " "; });
+        // Output: 2 4 6
+        //! [from_range]
+    }
+
     {
         //! [from_callable]
         rpp::source::from_callable([]() {return 49; }).subscribe([](int v) {std::cout << v << " "; });
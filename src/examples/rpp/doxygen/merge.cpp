@@ -0,0 +1,28 @@
+#include <rpp/rpp.hpp>
+#include <exception>
+#include <iostream>
+
+/**
+ * @example merge.cpp
+ **/
+int main()
+{
+    //! [merge]
+    rpp::source::just(rpp::source::just(1, 2), rpp::source::just(3, 4))
+            | rpp::operators::merge()
+            | rpp::operators::subscribe([](int v) { std::cout << v << " "; },
+                                        [](const std::exception_ptr&){},
+                                        []() { std::cout << "completed" << std::endl; });
+    // Output: 1 2 3 4 completed
+    //! [merge]
+
+    //! [merge_with]
+    rpp::source::just(1, 2)
+            | rpp::operators::merge_with(rpp::source::just(3, 4))
+            | rpp::operators::subscribe([](int v) { std::cout << v << " "; },
+                                        [](const std::exception_ptr&){},
+                                        []() { std::cout << "completed" << std::endl; });
+    // Output: 1 2 3 4 completed
+    //! [merge_with]
+    return 0;
+}
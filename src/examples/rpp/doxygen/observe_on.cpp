@@ -0,0 +1,23 @@
+#include <rpp/rpp.hpp>
+#include <exception>
+#include <iostream>
+
+/**
+ * @example observe_on.cpp
+ **/
+int main()
+{
+    //! [observe_on]
+    rpp::schedulers::run_loop loop{};
+    rpp::source::just(rpp::schedulers::immediate{}, 1, 2, 3)
+            | rpp::operators::observe_on(loop)
+            | rpp::operators::subscribe([](int v) { std::cout << v << " "; },
+                                        [](const std::exception_ptr&){},
+                                        []() { std::cout << "completed" << std::endl; });
+    std::cout << "subscribed ";
+    while (!loop.is_empty())
+        loop.dispatch();
+    // Output: subscribed 1 2 3 completed
+    //! [observe_on]
+    return 0;
+}
@@ -0,0 +1,16 @@
+#include <rpp/rpp.hpp>
+
+#include <iostream>
+
+/**
+ * \example range.cpp
+ **/
+
+int main() // NOLINT
+{
+    //! [range]
+    rpp::source::range(1, 5).subscribe([](int v) { std::cout << v << " "; });
+    // Output: 1 2 3 4 5
+    //! [range]
+    return 0;
+}
@@ -0,0 +1,28 @@
+#include <rpp/rpp.hpp>
+#include <exception>
+#include <iostream>
+
+/**
+ * @example subscribe_on.cpp
+ **/
+int main()
+{
+    //! [subscribe_on]
+    rpp::schedulers::run_loop loop{};
+    rpp::source::create<int>([](const auto& obs)
+            {
+                std::cout << "subscribed ";
+                obs.on_next(1);
+                obs.on_completed();
+            })
+            | rpp::operators::subscribe_on(loop)
+            | rpp::operators::subscribe([](int v) { std::cout << v << " "; },
+                                        [](const std::exception_ptr&){},
+                                        []() { std::cout << "completed" << std::endl; });
+    std::cout << "scheduled ";
+    while (!loop.is_empty())
+        loop.dispatch();
+    // Output: scheduled subscribed 1 completed
+    //! [subscribe_on]
+    return 0;
+}
@@ -21,4 +21,18 @@
 #  define RPP_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
 #else
 #  define RPP_NO_UNIQUE_ADDRESS [[no_unique_address]]
-#endif
\ No newline at end of file
+#endif
+
+// RPP_NO_EXCEPTIONS disables any exception handling inside RPP: user's callbacks are not wrapped into try/catch, so errors are expected to be passed via on_error explicitly.
+// Enabled automatically when compiler's support of exceptions is disabled.
+#if !defined(RPP_NO_EXCEPTIONS) && !defined(__cpp_exceptions) && !defined(__EXCEPTIONS) && !defined(_CPPUNWIND)
+#  define RPP_NO_EXCEPTIONS
+#endif
+
+#ifdef RPP_NO_EXCEPTIONS
+#  define RPP_TRY if constexpr (true)
+#  define RPP_CATCH(...) else
+#else
+#  define RPP_TRY try
+#  define RPP_CATCH(...) catch (__VA_ARGS__)
+#endif
@@ -12,44 +12,150 @@
 
 #include <rpp/disposables/fwd.hpp>
 
+#include <algorithm>
 #include <atomic>
-#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <utility>
 
 namespace rpp
 {
+/**
+ * @brief Disposable which disposes all added child disposables during own disposing.
+ * @details Children are kept in lock-free intrusive singly linked list: adding of child is just one CAS of the head, disposing exchanges the head with "disposed" marker.
+ * To prevent unbounded growth of long-lived disposable, already disposed and removed children are dropped from the list from time to time during adding of new ones
+ * (list is detached, filtered and spliced back), so amortized cost of add is still O(1).
+ * @note Children detached for filtering at the moment of concurrent dispose are disposed by thread performing filtering right after it, while `dispose` waits
+ * for such a filtering to finish: all children are disposed when `dispose` returns.
+ */
 class base_disposable
 {
+    struct node
+    {
+        enum class state : uint8_t
+        {
+            alive,   // child is owned by list
+            claimed, // list checks state of child right now
+            removed  // child is disposed or removed via handle
+        };
+
+        explicit node(std::shared_ptr<base_disposable>&& d, uint8_t refs_count)
+            : disposable{std::move(d)}
+            , refs{refs_count} {}
+
+        // returns true if child is taken by caller
+        bool try_take()
+        {
+            auto expected = state::alive;
+            while (!current_state.compare_exchange_weak(expected, state::removed, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                if (expected == state::removed)
+                    return false;
+                // list checks child right now, it is short operation
+                if (expected == state::claimed)
+                    std::this_thread::yield();
+                expected = state::alive;
+            }
+            return true;
+        }
+
+        static void release(node* n) noexcept
+        {
+            // no handle -> nobody else can reference node
+            if (n->refs.load(std::memory_order_acquire) == 1 || n->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                delete n;
+        }
+
+        std::shared_ptr<base_disposable> disposable;
+        node*                            next{};
+        std::atomic<state>               current_state{state::alive};
+        std::atomic<uint8_t>             refs;
+    };
+
+    // minimal amount of children added before removing of disposed ones
+    static constexpr size_t s_min_prune_threshold = 16;
+
 public:
+    /**
+     * @brief Handle of child disposable provides ability to remove this child from parent in O(1) without disposing of it.
+     */
+    class handle
+    {
+    public:
+        handle() = default;
+
+        handle(const handle&) = delete;
+        handle(handle&& other) noexcept
+            : m_node{std::exchange(other.m_node, nullptr)} {}
+
+        handle& operator=(const handle&) = delete;
+        handle& operator=(handle&& other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                m_node = std::exchange(other.m_node, nullptr);
+            }
+            return *this;
+        }
+
+        ~handle() noexcept { reset(); }
+
+        /**
+         * @brief Removes child from parent (if it is still there). Child is not disposed.
+         */
+        void remove() noexcept
+        {
+            if (m_node && m_node->try_take())
+                m_node->disposable.reset();
+            reset();
+        }
+
+    private:
+        friend class base_disposable;
+
+        explicit handle(node* n)
+            : m_node{n} {}
+
+        void reset() noexcept
+        {
+            if (m_node)
+                node::release(std::exchange(m_node, nullptr));
+        }
+
+    private:
+        node* m_node{};
+    };
+
     base_disposable()                       = default;
-    virtual ~base_disposable() noexcept     = default;
+    virtual ~base_disposable() noexcept
+    {
+        if (auto* head = m_head.load(std::memory_order_acquire); head != disposed_marker())
+            release_nodes(head);
+    }
 
     base_disposable(const base_disposable&) = delete;
     base_disposable(base_disposable&&)      = delete;
 
-    bool is_disposed() const
+    bool is_disposed() const noexcept
     {
-        return m_current_state.load(std::memory_order_acquire) == State::Disposed;
+        return m_head.load(std::memory_order_acquire) == disposed_marker();
     }
 
     void dispose()
     {
-        while (true)
-        {
-            State expected{State::None};
-            if (m_current_state.compare_exchange_strong(expected, State::Disposed, std::memory_order::acq_rel))
-            {
-                dispose_impl();
-
-                for (const auto& d : m_disposables)
-                    d->dispose();
+        auto* head = m_head.exchange(disposed_marker(), std::memory_order_seq_cst);
+        if (head == disposed_marker())
+            return;
 
-                m_disposables.clear();
-                return;
-            }
+        dispose_impl();
+        dispose_nodes(head);
 
-            if (expected == State::Disposed)
-                return;
-        }
+        // children detached by concurrent filtering are disposed by filtering thread
+        while (m_prunes_in_progress.load(std::memory_order_seq_cst) != 0)
+            std::this_thread::yield();
     }
 
     void add(std::shared_ptr<base_disposable> disposable)
@@ -57,36 +163,142 @@ public:
         if (!disposable || disposable.get() == this || disposable->is_disposed())
             return;
 
-        while (true)
+        add_node(new node{std::move(disposable), 1});
+    }
+
+    /**
+     * @brief Same as add, but returns handle to remove this child in O(1) later.
+     */
+    handle add_with_handle(std::shared_ptr<base_disposable> disposable)
+    {
+        if (!disposable || disposable.get() == this || disposable->is_disposed())
+            return handle{};
+
+        auto* new_node = new node{std::move(disposable), 2};
+        add_node(new_node);
+        return handle{new_node};
+    }
+
+protected:
+    virtual void dispose_impl() {}
+
+private:
+    static node* disposed_marker() noexcept { return reinterpret_cast<node*>(alignof(node)); } // NOLINT
+
+    void add_node(node* new_node)
+    {
+        if (!push(new_node, new_node))
+            return;
+
+        if (m_children_count.fetch_add(1, std::memory_order_relaxed) + 1 >= m_prune_threshold.load(std::memory_order_relaxed))
+            remove_disposed_children();
+    }
+
+    // returns false in case of this disposable is already disposed: nodes are disposed immediately
+    bool push(node* first, node* last)
+    {
+        auto* head = m_head.load(std::memory_order_acquire);
+        do
         {
-            State expected{State::None};
-            if (m_current_state.compare_exchange_strong(expected, State::Edit, std::memory_order::acq_rel))
+            if (head == disposed_marker())
             {
-                m_disposables.emplace_back(std::move(disposable));
-                m_current_state.store(State::None, std::memory_order::release);
-                return;
+                // next of last node could be set to stale head during previous attempt
+                last->next = nullptr;
+                dispose_nodes(first);
+                return false;
             }
+            last->next = head;
+        } while (!m_head.compare_exchange_weak(head, first, std::memory_order_acq_rel, std::memory_order_acquire));
+        return true;
+    }
 
-            if (expected == State::Disposed)
+    void remove_disposed_children()
+    {
+        // announced before detaching of list: either dispose observes it and waits, or this thread observes disposed marker
+        m_prunes_in_progress.fetch_add(1, std::memory_order_seq_cst);
+
+        auto* head = m_head.load(std::memory_order_seq_cst);
+        do
+        {
+            if (head == nullptr || head == disposed_marker())
             {
-                disposable->dispose();
+                m_prunes_in_progress.fetch_sub(1, std::memory_order_release);
                 return;
             }
+        } while (!m_head.compare_exchange_weak(head, nullptr, std::memory_order_seq_cst, std::memory_order_seq_cst));
+
+        // detached list is owned exclusively by this thread now, only handles can remove children concurrently
+        node*  alive_first{};
+        node*  alive_last{};
+        size_t alive_count{};
+        while (head)
+        {
+            auto* next = head->next;
+            if (is_alive(*head))
+            {
+                head->next  = alive_first;
+                alive_first = head;
+                if (!alive_last)
+                    alive_last = head;
+                ++alive_count;
+            }
+            else
+            {
+                node::release(head);
+            }
+            head = next;
         }
+
+        m_children_count.store(alive_count, std::memory_order_relaxed);
+        m_prune_threshold.store(std::max(s_min_prune_threshold, alive_count * 2), std::memory_order_relaxed);
+
+        if (alive_first)
+            push(alive_first, alive_last);
+
+        m_prunes_in_progress.fetch_sub(1, std::memory_order_release);
     }
 
-protected:
-    virtual void dispose_impl() {}
+    static bool is_alive(node& n)
+    {
+        auto expected = node::state::alive;
+        if (!n.current_state.compare_exchange_strong(expected, node::state::claimed, std::memory_order_acq_rel, std::memory_order_acquire))
+            return false;
 
-private:
-    enum class State
+        if (n.disposable->is_disposed())
+        {
+            n.disposable.reset();
+            n.current_state.store(node::state::removed, std::memory_order_release);
+            return false;
+        }
+
+        n.current_state.store(node::state::alive, std::memory_order_release);
+        return true;
+    }
+
+    static void dispose_nodes(node* head)
     {
-        None,    // default state
-        Edit,    // set it during adding new element into deps or removing. After success -> back to None
-        Disposed // permanent state after dispose
-    };
+        while (head)
+        {
+            auto* current = std::exchange(head, head->next);
+            if (current->try_take())
+            {
+                const auto disposable = std::move(current->disposable);
+                disposable->dispose();
+            }
+            node::release(current);
+        }
+    }
+
+    static void release_nodes(node* head) noexcept
+    {
+        while (head)
+            node::release(std::exchange(head, head->next));
+    }
 
-    std::atomic<State>                            m_current_state{};
-    std::vector<std::shared_ptr<base_disposable>> m_disposables{};
+private:
+    std::atomic<node*>  m_head{};
+    std::atomic<size_t> m_children_count{};
+    std::atomic<size_t> m_prune_threshold{s_min_prune_threshold};
+    std::atomic<size_t> m_prunes_in_progress{};
 };
 }
@@ -20,7 +20,7 @@ class disposable_wrapper
 public:
     disposable_wrapper(std::shared_ptr<base_disposable> disposable = {}) : m_disposable{std::move(disposable)} {}
 
-    bool is_disposed() const { return !m_disposable || m_disposable->is_disposed(); }
+    bool is_disposed() const noexcept { return !m_disposable || m_disposable->is_disposed(); }
 
     void dispose() const
     {
@@ -35,6 +35,19 @@ public:
         else if (other)
             other->dispose();
     }
+
+    /**
+     * @brief Same as add, but returns handle to remove added disposable from this one in O(1) later.
+     */
+    base_disposable::handle add_with_handle(std::shared_ptr<base_disposable> other) const
+    {
+        if (m_disposable)
+            return m_disposable->add_with_handle(std::move(other));
+        if (other)
+            other->dispose();
+        return {};
+    }
+
     const std::shared_ptr<base_disposable>& get_original() const { return m_disposable; }
 
 private:
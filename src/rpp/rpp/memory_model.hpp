@@ -11,6 +11,8 @@
 #pragma once
 
 #include <concepts>
+#include <memory_resource>
+#include <utility>
 
 namespace rpp::memory_model
 {
@@ -18,10 +20,49 @@ namespace rpp::memory_model
     struct use_stack{};
     // make shared_ptr once and avoid any future copies/moves
     struct use_shared{};
+    // same as use_shared, but memory is allocated from resource of active rpp::memory_model::arena_scope (or std::pmr::get_default_resource() if there is no such a scope)
+    struct use_arena{};
+
+/**
+ * @brief RAII guard setting memory resource used by current thread for pipelines created with rpp::memory_model::use_arena and for schedulables scheduled
+ * to rpp::schedulers::current_thread while guard is alive.
+ * @details Useful for short-lived pipelines: with `std::pmr::monotonic_buffer_resource` all memory of such a pipeline is released in one shot. Scopes can be nested, previous resource is restored on destruction of guard.
+ * Schedulables of threaded schedulers (new_thread, thread_pool, run_loop and etc) are destroyed by other threads, so they never use resource of scope.
+ *
+ * @warning Resource should outlive everything allocated from it: pipelines created with rpp::memory_model::use_arena and schedulables scheduled inside of scope.
+ * In case of such a pipeline is used or destroyed from another threads (for example, subscribed via rpp::operators::subscribe_on), resource should be thread-safe
+ * (e.g. `std::pmr::synchronized_pool_resource`).
+ */
+class arena_scope
+{
+public:
+    explicit arena_scope(std::pmr::memory_resource& resource) noexcept
+        : m_previous{std::exchange(current(), &resource)} {}
+
+    arena_scope(const arena_scope&) = delete;
+    arena_scope(arena_scope&&)      = delete;
+
+    ~arena_scope() noexcept { current() = m_previous; }
+
+    /**
+     * @brief Resource of the innermost active scope of current thread or nullptr if there is no such a scope.
+     */
+    static std::pmr::memory_resource* get_resource() noexcept { return current(); }
+
+private:
+    static std::pmr::memory_resource*& current() noexcept
+    {
+        static thread_local std::pmr::memory_resource* s_resource{};
+        return s_resource;
+    }
+
+private:
+    std::pmr::memory_resource* m_previous;
+};
 } // namespace rpp::memory_model
 
 namespace rpp::constraint
 {
 template<typename T>
-concept memory_model = std::same_as<rpp::memory_model::use_shared, T> || std::same_as<rpp::memory_model::use_stack, T>;
-}
\ No newline at end of file
+concept memory_model = std::same_as<rpp::memory_model::use_shared, T> || std::same_as<rpp::memory_model::use_stack, T> || std::same_as<rpp::memory_model::use_arena, T>;
+}
@@ -124,16 +124,27 @@ public:
     auto as_dynamic() const& { return rpp::dynamic_observable<Type>{*this}; }
     auto as_dynamic() && { return rpp::dynamic_observable<Type>{std::move(*this)}; }
 
+    /**
+     * @brief Applies operator to this observable.
+     * @details In case of strategy of this observable can fuse passed operator into itself (see rpp::operators::details::fused_observer_strategy), then
+     * fused observable is returned instead of wrapping this observable.
+     */
     template<constraint::operators<const base_observable<Type, Strategy>&> Op>
     auto operator|(Op&& op) const &
     {
-        return std::forward<Op>(op)(*this);
+        if constexpr (requires { m_strategy.fuse(std::forward<Op>(op)); })
+            return m_strategy.fuse(std::forward<Op>(op));
+        else
+            return std::forward<Op>(op)(*this);
     }
 
     template<constraint::operators<base_observable<Type, Strategy>&&> Op>
     auto operator|(Op&& op) &&
     {
-        return std::forward<Op>(op)(std::move(*this));
+        if constexpr (requires { std::move(m_strategy).fuse(std::forward<Op>(op)); })
+            return std::move(m_strategy).fuse(std::forward<Op>(op));
+        else
+            return std::forward<Op>(op)(std::move(*this));
     }
 
     template<typename...Args>
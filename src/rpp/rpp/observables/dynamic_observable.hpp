@@ -12,7 +12,10 @@
 #include <rpp/observables/fwd.hpp>
 #include <rpp/observers/dynamic_observer.hpp>
 
+#include <cstddef>
 #include <memory>
+#include <new>
+#include <type_traits>
 #include <utility>
 
 namespace rpp::details::observable
@@ -20,26 +23,120 @@ namespace rpp::details::observable
 template<typename T, typename Observable>
 void forwarding_subscribe(const void* const ptr, dynamic_observer<T>&& obs) { static_cast<const Observable*>(ptr)->subscribe(std::move(obs)); }
 
+template<typename Observable>
+void forwarding_copy(const void* const from, void* const to) noexcept { new (to) Observable{*static_cast<const Observable*>(from)}; }
+
+template<typename Observable>
+void forwarding_relocate(void* const from, void* const to) noexcept
+{
+    new (to) Observable{std::move(*static_cast<Observable*>(from))};
+    static_cast<Observable*>(from)->~Observable();
+}
+
+template<typename Observable>
+void forwarding_destroy(void* const ptr) noexcept { static_cast<Observable*>(ptr)->~Observable(); }
+
+/**
+ * @brief Type-erased strategy of rpp::dynamic_observable.
+ * @details Original observable is kept inside of inline buffer in case of it fits and can be copied without exceptions, otherwise it is allocated at heap and shared between copies.
+ */
 template<constraint::decayed_type Type>
 class dynamic_strategy final
 {
+    static constexpr size_t s_inline_size = 64;
+
+    template<typename Observable>
+    static constexpr bool fits_inline = sizeof(Observable) <= s_inline_size && alignof(Observable) <= alignof(std::max_align_t)
+                                        && std::is_nothrow_copy_constructible_v<Observable> && std::is_nothrow_move_constructible_v<Observable>;
+
 public:
     template<constraint::observable_strategy<Type> Strategy>
         requires (!constraint::decayed_same_as<Strategy, dynamic_strategy<Type>>)
     explicit dynamic_strategy(base_observable<Type, Strategy>&& observable)
-        : m_forwarder{std::make_shared<base_observable<Type, Strategy>>(std::move(observable))}
-        , m_vtable{vtable::template create<base_observable<Type, Strategy>>()} {}
+        : m_vtable{vtable::template create<base_observable<Type, Strategy>>()}
+    {
+        emplace<base_observable<Type, Strategy>>(std::move(observable));
+    }
 
     template<constraint::observable_strategy<Type> Strategy>
         requires (!constraint::decayed_same_as<Strategy, dynamic_strategy<Type>>)
     explicit dynamic_strategy(const base_observable<Type, Strategy>& observable)
-        : m_forwarder{std::make_shared<base_observable<Type, Strategy>>(observable)}
-        , m_vtable{vtable::template create<base_observable<Type, Strategy>>()} {}
-        
+        : m_vtable{vtable::template create<base_observable<Type, Strategy>>()}
+    {
+        emplace<base_observable<Type, Strategy>>(observable);
+    }
+
+    dynamic_strategy(const dynamic_strategy& other)
+        : m_vtable{other.m_vtable}
+    {
+        assign(other);
+    }
+
+    dynamic_strategy(dynamic_strategy&& other) noexcept
+        : m_vtable{other.m_vtable}
+    {
+        assign(std::move(other));
+    }
+
+    dynamic_strategy& operator=(const dynamic_strategy&) = delete;
+    dynamic_strategy& operator=(dynamic_strategy&&)      = delete;
+
+    ~dynamic_strategy() noexcept
+    {
+        if (is_inline())
+            m_vtable->destroy(m_storage);
+    }
+
     template<constraint::observer_strategy<Type> ObserverStrategy>
-    void subscribe(base_observer<Type, ObserverStrategy>&& observer) const 
+    void subscribe(base_observer<Type, ObserverStrategy>&& observer) const
     {
-        m_vtable->subscribe(m_forwarder.get(), std::move(observer).as_dynamic());
+        m_vtable->subscribe(m_forwarder, std::move(observer).as_dynamic());
+    }
+
+private:
+    template<typename Observable, typename Arg>
+    void emplace(Arg&& observable)
+    {
+        if constexpr (fits_inline<Observable>)
+        {
+            m_forwarder = new (m_storage) Observable{std::forward<Arg>(observable)};
+        }
+        else
+        {
+            m_shared    = std::make_shared<Observable>(std::forward<Arg>(observable));
+            m_forwarder = m_shared.get();
+        }
+    }
+
+    bool is_inline() const { return m_forwarder == static_cast<const void*>(m_storage); }
+
+    void assign(const dynamic_strategy& other) noexcept
+    {
+        if (other.is_inline())
+        {
+            m_vtable->copy(other.m_forwarder, m_storage);
+            m_forwarder = m_storage;
+        }
+        else
+        {
+            m_shared    = other.m_shared;
+            m_forwarder = other.m_forwarder;
+        }
+    }
+
+    void assign(dynamic_strategy&& other) noexcept
+    {
+        if (other.is_inline())
+        {
+            m_vtable->relocate(other.m_storage, m_storage);
+            m_forwarder       = m_storage;
+            other.m_forwarder = nullptr;
+        }
+        else
+        {
+            m_shared    = std::move(other.m_shared);
+            m_forwarder = std::exchange(other.m_forwarder, nullptr);
+        }
     }
 
 private:
@@ -47,18 +144,27 @@ private:
     {
         void (*subscribe)(const void*, dynamic_observer<Type>&&){};
 
+        void (*copy)(const void*, void*) noexcept{};
+        void (*relocate)(void*, void*) noexcept{};
+        void (*destroy)(void*) noexcept{};
+
         template<constraint::observable Observable>
         static const vtable* create() noexcept
         {
             static vtable s_res{
-                .subscribe = forwarding_subscribe<Type, Observable>
+                .subscribe = forwarding_subscribe<Type, Observable>,
+                .copy = forwarding_copy<Observable>,
+                .relocate = forwarding_relocate<Observable>,
+                .destroy = forwarding_destroy<Observable>,
             };
             return &s_res;
         }
     };
 
 private:
-    std::shared_ptr<void> m_forwarder;
-    const vtable*         m_vtable;
+    alignas(std::max_align_t) std::byte m_storage[s_inline_size];
+    std::shared_ptr<void>               m_shared{};
+    const void*                         m_forwarder{};
+    const vtable*                       m_vtable;
 };
 } // namespace rpp::details::observer
@@ -18,9 +18,13 @@
 #include <rpp/utils/functors.hpp>
 #include <rpp/utils/exceptions.hpp>
 
+#include <cstddef>
 #include <exception>
+#include <limits>
+#include <span>
 #include <stdexcept>
 #include <type_traits>
+#include <utility>
 
 namespace rpp::details
 {
@@ -46,13 +50,24 @@ class external_disposable_strategy : private upstream_disposable
 public:
     explicit external_disposable_strategy(disposable_wrapper disposable) : m_external_disposable(std::move(disposable)) {}
 
+    /**
+     * @brief Copy shares external disposable (and so disposed state) with original one. Upstream is already tracked by external disposable, so copy doesn't track it again.
+     */
+    external_disposable_strategy(const external_disposable_strategy& other) noexcept
+        : upstream_disposable{other}
+        , m_external_disposable{other.m_external_disposable} {}
+
+    external_disposable_strategy(external_disposable_strategy&&) noexcept = default;
+
     void set_upstream(const disposable_wrapper& d)
     {
         upstream_disposable::set_upstream_impl(d);
-        m_external_disposable.add(d.get_original());
+        // previous upstream is disposed already, so no need to keep it inside of long-living external disposable
+        m_upstream_handle.remove();
+        m_upstream_handle = m_external_disposable.add_with_handle(d.get_original());
     }
 
-    bool is_disposed() const
+    bool is_disposed() const noexcept
     {
         return m_external_disposable.is_disposed();
     }
@@ -65,6 +80,7 @@ public:
 
 private:
     disposable_wrapper             m_external_disposable{};
+    base_disposable::handle        m_upstream_handle{};
 };
 
 class local_disposable_strategy : private upstream_disposable
@@ -76,7 +92,7 @@ public:
         upstream_disposable::set_upstream_impl(d);
     }
 
-    bool is_disposed() const
+    bool is_disposed() const noexcept
     {
         return m_is_disposed;
     }
@@ -94,13 +110,30 @@ private:
 struct none_disposable_strategy
 {
     static void set_upstream(const disposable_wrapper&) {}
-    static bool is_disposed() { return false; }
+    static bool is_disposed() noexcept { return false; }
     static void dispose() {}
 };
 
 template<constraint::decayed_type Type, constraint::observer_strategy<Type> Strategy, typename DisposablesStrategy>
 class base_observer_impl
 {
+    static constexpr bool is_nothrow_is_disposed = noexcept(std::declval<const DisposablesStrategy&>().is_disposed()) && noexcept(std::declval<const Strategy&>().is_disposed());
+
+    template<typename T>
+    static constexpr bool is_nothrow_on_next = is_nothrow_is_disposed && noexcept(std::declval<const Strategy&>().on_next(std::declval<T>()));
+
+#ifdef RPP_NO_EXCEPTIONS
+    static constexpr bool no_exceptions = true;
+#else
+    static constexpr bool no_exceptions = false;
+#endif
+
+public:
+    /**
+     * @brief Observer passes batch of values to its strategy as is instead of splitting it to separate on_next calls.
+     */
+    static constexpr bool has_native_batch = constraint::observer_strategy_with_batch<Strategy, Type>;
+
 protected:
     template<typename... Args>
         requires constraint::is_constructible_from<Strategy, Args&&...>
@@ -134,7 +167,7 @@ public:
      * @return true if observer disposed and no longer interested in emissions
      * @return false if observer still interested in emissions
      */
-    bool is_disposed() const
+    bool is_disposed() const noexcept(is_nothrow_is_disposed)
     {
         return m_disposable.is_disposed() ||  m_strategy.is_disposed();
     }
@@ -142,17 +175,26 @@ public:
      * @brief Observable calls this method to notify observer about new value.
      *
      * @note obtains value by const-reference to original object.
+     * @note exceptions thrown by strategy are passed to on_error. In case of strategy's on_next is noexcept (or RPP_NO_EXCEPTIONS is defined) no any try/catch is used at all.
      */
-    void on_next(const Type& v) const
+    void on_next(const Type& v) const noexcept(is_nothrow_on_next<const Type&>)
     {
-        try
+        if constexpr (is_nothrow_on_next<const Type&> || no_exceptions)
         {
             if (!is_disposed())
                 m_strategy.on_next(v);
         }
-        catch(...)
+        else
         {
-            on_error(std::current_exception());
+            RPP_TRY
+            {
+                if (!is_disposed())
+                    m_strategy.on_next(v);
+            }
+            RPP_CATCH(...)
+            {
+                on_error(std::current_exception());
+            }
         }
     }
 
@@ -160,20 +202,76 @@ public:
      * @brief Observable calls this method to notify observer about new value.
      *
      * @note obtains value by rvalue-reference to original object
+     * @note exceptions thrown by strategy are passed to on_error. In case of strategy's on_next is noexcept (or RPP_NO_EXCEPTIONS is defined) no any try/catch is used at all.
      */
-    void on_next(Type&& v) const
+    void on_next(Type&& v) const noexcept(is_nothrow_on_next<Type&&>)
     {
-        try
+        if constexpr (is_nothrow_on_next<Type&&> || no_exceptions)
         {
             if (!is_disposed())
                 m_strategy.on_next(std::move(v));
         }
-        catch(...)
+        else
         {
-            on_error(std::current_exception());
+            RPP_TRY
+            {
+                if (!is_disposed())
+                    m_strategy.on_next(std::move(v));
+            }
+            RPP_CATCH(...)
+            {
+                on_error(std::current_exception());
+            }
         }
     }
 
+    /**
+     * @brief Observable calls this method to notify observer about several new values at once.
+     *
+     * @details Values are passed to strategy as is in case of it satisfies rpp::constraint::observer_strategy_with_batch, otherwise they are
+     * passed to on_next one by one till observer is disposed.
+     * @note Operators handling batch natively can invoke their callbacks for several values before passing them downstream, but never for more
+     * values than downstream accepts (see batch_demand) and values processed before exception are passed downstream before error.
+     */
+    void on_next_batch(std::span<const Type> values) const
+    {
+        if constexpr (has_native_batch)
+        {
+            RPP_TRY
+            {
+                if (!is_disposed())
+                    m_strategy.on_next_batch(values);
+            }
+            RPP_CATCH(...)
+            {
+                on_error(std::current_exception());
+            }
+        }
+        else
+        {
+            for (const auto& v : values)
+            {
+                if (is_disposed())
+                    return;
+
+                on_next(v);
+            }
+        }
+    }
+
+    /**
+     * @brief Maximum amount of values observer processes for sure before it could be disposed by itself: passing batch of such size doesn't invoke
+     * any callback which wouldn't be invoked in case of passing values one by one.
+     * @see rpp::constraint::observer_strategy_with_batch_demand
+     */
+    size_t batch_demand() const
+    {
+        if constexpr (constraint::observer_strategy_with_batch_demand<Strategy>)
+            return m_strategy.batch_demand();
+        else
+            return std::numeric_limits<size_t>::max();
+    }
+
     /**
      * @brief Observable calls this method to notify observer about some error during generation next data.
      * @warning Obtaining this of this call means no any further on_next/on_error or on_completed calls from this Observable
@@ -255,7 +353,11 @@ public:
         : details::base_observer_impl<Type, Strategy, details::external_disposable_strategy>{details::external_disposable_strategy{std::move(disposable)}, std::forward<Args>(args)...}
     {}
 
-    base_observer(const base_observer&)     = delete;
+    /**
+     * @brief Observer with external disposable is copyable in case of its strategy is copyable: all copies share the same disposable and
+     * so the same disposed state. rpp::dynamic_observer uses it to keep such an observer inline.
+     */
+    base_observer(const base_observer&)     = default;
     base_observer(base_observer&&) noexcept = default;
 
     /**
@@ -12,7 +12,11 @@
 #include <rpp/observers/fwd.hpp>
 #include <rpp/disposables/fwd.hpp>
 
+#include <cstddef>
 #include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
 #include <utility>
 
 namespace rpp::details::observer
@@ -23,6 +27,12 @@ void forwarding_on_next_lvalue(const void* const ptr, const T& v) { static_cast<
 template<typename T, typename Strategy>
 void forwarding_on_next_rvalue(const void* const ptr, T&& v) { static_cast<const Strategy*>(ptr)->on_next(std::forward<T>(v)); }
 
+template<typename T, typename Strategy>
+void forwarding_on_next_batch(const void* const ptr, std::span<const T> values) { static_cast<const Strategy*>(ptr)->on_next_batch(values); }
+
+template<typename Strategy>
+size_t forwarding_batch_demand(const void* const ptr) { return static_cast<const Strategy*>(ptr)->batch_demand(); }
+
 template<typename Strategy>
 void forwarding_on_error(const void* const ptr, const std::exception_ptr& err) { static_cast<const Strategy*>(ptr)->on_error(err); }
 
@@ -35,55 +45,161 @@ void forwarding_set_upstream(void* const ptr, const disposable_wrapper& d) { sta
 template<typename Strategy>
 bool forwarding_is_disposed(const void* const ptr) { return static_cast<const Strategy*>(ptr)->is_disposed(); }
 
+template<typename Strategy>
+void forwarding_copy(const void* const from, void* const to) noexcept
+{
+    // used only for observers kept inline, any other observer is shared between copies
+    if constexpr (std::is_nothrow_copy_constructible_v<Strategy>)
+        new (to) Strategy{*static_cast<const Strategy*>(from)};
+}
+
+template<typename Strategy>
+void forwarding_relocate(void* const from, void* const to) noexcept
+{
+    new (to) Strategy{std::move(*static_cast<Strategy*>(from))};
+    static_cast<Strategy*>(from)->~Strategy();
+}
+
+template<typename Strategy>
+void forwarding_destroy(void* const ptr) noexcept { static_cast<Strategy*>(ptr)->~Strategy(); }
+
+/**
+ * @brief Type-erased strategy of rpp::dynamic_observer.
+ * @details Copies of dynamic_observer are the same observer with the same state. Original observer is kept inside of inline buffer in case of it fits and
+ * its copies share state anyway (see copyable rpp::base_observer with external disposable), so copy of dynamic_observer just copies it. Any other observer
+ * is allocated at heap and shared between copies. Copy never mutates the source, so it can be made from any thread concurrently with emissions.
+ */
 template<constraint::decayed_type Type>
 class dynamic_strategy final
 {
+    static constexpr size_t s_inline_size = 64;
+
+    template<typename Observer>
+    static constexpr bool fits_inline = sizeof(Observer) <= s_inline_size && alignof(Observer) <= alignof(std::max_align_t)
+                                        && std::is_nothrow_copy_constructible_v<Observer> && std::is_nothrow_move_constructible_v<Observer>;
+
 public:
     template<constraint::observer_strategy<Type> Strategy>
         requires (!constraint::decayed_same_as<Strategy, dynamic_strategy<Type>>)
     explicit dynamic_strategy(base_observer<Type, Strategy>&& observer)
-        : m_forwarder{std::make_shared<base_observer<Type, Strategy>>(std::move(observer))}
-        , m_vtable{vtable::template create<base_observer<Type, Strategy>>()} {}
+        : m_vtable{vtable::template create<base_observer<Type, Strategy>>()}
+    {
+        using observer_t = base_observer<Type, Strategy>;
+        if constexpr (fits_inline<observer_t>)
+        {
+            m_forwarder = new (m_storage) observer_t{std::move(observer)};
+        }
+        else
+        {
+            m_shared    = std::make_shared<observer_t>(std::move(observer));
+            m_forwarder = m_shared.get();
+        }
+    }
 
-    dynamic_strategy(const dynamic_strategy&) = default;
-    dynamic_strategy(dynamic_strategy&&) noexcept = default;
+    dynamic_strategy(const dynamic_strategy& other)
+        : m_vtable{other.m_vtable}
+    {
+        assign(other);
+    }
 
-    void set_upstream(const disposable_wrapper& d) { m_vtable->set_upstream(m_forwarder.get(), d); }
-    bool is_disposed() const                       { return m_vtable->is_disposed(m_forwarder.get()); }
+    dynamic_strategy(dynamic_strategy&& other) noexcept
+        : m_vtable{other.m_vtable}
+    {
+        assign(std::move(other));
+    }
 
-    void on_next(const Type& v) const                     { m_vtable->on_next_lvalue(m_forwarder.get(), v);            }
-    void on_next(Type&& v) const                          { m_vtable->on_next_rvalue(m_forwarder.get(), std::move(v)); }
-    void on_error(const std::exception_ptr& err) const    { m_vtable->on_error(m_forwarder.get(), err);                }
-    void on_completed() const                             { m_vtable->on_completed(m_forwarder.get());                 }
+    dynamic_strategy& operator=(const dynamic_strategy&) = delete;
+    dynamic_strategy& operator=(dynamic_strategy&&)      = delete;
+
+    ~dynamic_strategy() noexcept
+    {
+        if (is_inline())
+            m_vtable->destroy(m_storage);
+    }
+
+    void set_upstream(const disposable_wrapper& d) { m_vtable->set_upstream(m_forwarder, d); }
+    bool is_disposed() const                       { return m_vtable->is_disposed(m_forwarder); }
+
+    void on_next(const Type& v) const                      { m_vtable->on_next_lvalue(m_forwarder, v);            }
+    void on_next(Type&& v) const                           { m_vtable->on_next_rvalue(m_forwarder, std::move(v)); }
+    void on_next_batch(std::span<const Type> values) const { m_vtable->on_next_batch(m_forwarder, values);        }
+    size_t batch_demand() const                            { return m_vtable->batch_demand(m_forwarder);          }
+    void on_error(const std::exception_ptr& err) const     { m_vtable->on_error(m_forwarder, err);                }
+    void on_completed() const                              { m_vtable->on_completed(m_forwarder);                 }
+
+private:
+    bool is_inline() const { return m_forwarder == static_cast<const void*>(m_storage); }
+
+    void assign(const dynamic_strategy& other) noexcept
+    {
+        if (other.is_inline())
+        {
+            m_vtable->copy(other.m_forwarder, m_storage);
+            m_forwarder = m_storage;
+        }
+        else
+        {
+            m_shared    = other.m_shared;
+            m_forwarder = other.m_forwarder;
+        }
+    }
+
+    void assign(dynamic_strategy&& other) noexcept
+    {
+        if (other.is_inline())
+        {
+            m_vtable->relocate(other.m_storage, m_storage);
+            m_forwarder       = m_storage;
+            other.m_forwarder = nullptr;
+        }
+        else
+        {
+            m_shared    = std::move(other.m_shared);
+            m_forwarder = std::exchange(other.m_forwarder, nullptr);
+        }
+    }
 
 private:
     struct vtable
     {
         void (*on_next_lvalue)(const void*, const Type&){};
         void (*on_next_rvalue)(const void*, Type&&){};
+        void (*on_next_batch)(const void*, std::span<const Type>){};
+        size_t (*batch_demand)(const void*){};
         void (*on_error)(const void*, const std::exception_ptr&){};
         void (*on_completed)(const void*){};
 
         void (*set_upstream)(void*, const disposable_wrapper&){};
         bool (*is_disposed)(const void*){};
 
+        void (*copy)(const void*, void*) noexcept{};
+        void (*relocate)(void*, void*) noexcept{};
+        void (*destroy)(void*) noexcept{};
+
         template<constraint::observer Strategy>
         static const vtable* create() noexcept
         {
             static vtable s_res{
                 .on_next_lvalue = forwarding_on_next_lvalue<Type, Strategy>,
                 .on_next_rvalue = forwarding_on_next_rvalue<Type, Strategy>,
+                .on_next_batch = forwarding_on_next_batch<Type, Strategy>,
+                .batch_demand = forwarding_batch_demand<Strategy>,
                 .on_error = forwarding_on_error<Strategy>,
                 .on_completed = forwarding_on_completed<Strategy>,
                 .set_upstream = forwarding_set_upstream<Strategy>,
                 .is_disposed = forwarding_is_disposed<Strategy>,
+                .copy = forwarding_copy<Strategy>,
+                .relocate = forwarding_relocate<Strategy>,
+                .destroy = forwarding_destroy<Strategy>,
             };
             return &s_res;
         }
     };
 
 private:
-    std::shared_ptr<void> m_forwarder;
-    const vtable*         m_vtable;
+    alignas(std::max_align_t) std::byte m_storage[s_inline_size];
+    std::shared_ptr<void>               m_shared{};
+    void*                               m_forwarder{};
+    const vtable*                       m_vtable;
 };
 } // namespace rpp::details::observer
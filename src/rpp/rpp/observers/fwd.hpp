@@ -16,7 +16,9 @@
 #include <rpp/utils/functors.hpp>
 
 #include <concepts>
+#include <cstddef>
 #include <exception>
+#include <span>
 #include <type_traits>
 
 namespace rpp::constraint
@@ -41,6 +43,31 @@ concept observer_strategy = requires(const S& const_strategy, S& strategy, const
     strategy.set_upstream(disposable);
     { strategy.is_disposed() } -> std::same_as<bool>;
 };
+
+/**
+ * @brief Strategy of observer which can handle several values at once via `on_next_batch(std::span<const Type>)`.
+ * @details Batch channel is optional: if strategy doesn't provide it, observer passes values of batch to `on_next` one by one.
+ *
+ * @ingroup observers
+ */
+template<typename S, typename Type>
+concept observer_strategy_with_batch = observer_strategy<S, Type> && requires(const S& const_strategy, std::span<const Type> values)
+{
+    const_strategy.on_next_batch(values);
+};
+
+/**
+ * @brief Strategy of observer which can stop accepting values by itself (like `take`) reports via `batch_demand()` how many values it processes for sure.
+ * @details Operators computing values of batch ahead (like `map`) never compute more values than this amount before passing them downstream, so
+ * user's callbacks are invoked for the same values as in case of passing values one by one. Strategies without this method accept any amount.
+ *
+ * @ingroup observers
+ */
+template<typename S>
+concept observer_strategy_with_batch_demand = requires(const S& const_strategy)
+{
+    { const_strategy.batch_demand() } -> std::convertible_to<size_t>;
+};
 } // namespace rpp::constraint
 
 namespace rpp::details::observer
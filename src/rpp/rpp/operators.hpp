@@ -29,6 +29,8 @@
  * @ingroup operators
  */
 
+ #include <rpp/operators/concat_map.hpp>
+ #include <rpp/operators/flat_map.hpp>
  #include <rpp/operators/map.hpp>
  #include <rpp/operators/subscribe.hpp>
 
@@ -52,6 +54,15 @@
 
  #include <rpp/operators/take_while.hpp>
 
+ /**
+ * @defgroup combining_operators Combining Operators
+ * @brief Combining operators are operators that combines emissions of multiple observables into same observable by some rule
+ * @see https://reactivex.io/documentation/operators.html#combining
+ * @ingroup operators
+ */
+
+ #include <rpp/operators/merge.hpp>
+
  /**
  * @defgroup utility_operators Utility Operators
  * @brief Utility operators are operators that provide some extra functionality without changing of original values, but changing of behaviour
@@ -59,4 +70,6 @@
  * @ingroup operators
  */
 
- #include <rpp/operators/repeat.hpp>
\ No newline at end of file
+ #include <rpp/operators/observe_on.hpp>
+ #include <rpp/operators/repeat.hpp>
+ #include <rpp/operators/subscribe_on.hpp>
\ No newline at end of file
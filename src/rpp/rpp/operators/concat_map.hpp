@@ -0,0 +1,333 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+#include <rpp/defs.hpp>
+#include <rpp/disposables/base_disposable.hpp>
+#include <rpp/disposables/disposable_wrapper.hpp>
+#include <rpp/observables/base_observable.hpp>
+#include <rpp/observers/base_observer.hpp>
+#include <rpp/operators/details/inner_subscription_slot.hpp>
+#include <rpp/operators/details/serialized_emitter.hpp>
+#include <rpp/operators/details/spsc_queue.hpp>
+#include <rpp/operators/details/strategy.hpp>
+#include <rpp/operators/details/weak_disposable.hpp>
+#include <rpp/sources/concat.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace rpp::operators::details
+{
+/**
+ * @brief Shared state of concat_map: keeps values of source observable waiting for their turn and subscribes to observables obtained from them one by one.
+ * @details Inner observables are subscribed only by "drainer" (thread which moves `m_wip` from 0). Values arrived while inner observable is active are
+ * buffered in rpp::operators::details::spsc_queue as is, so callable is applied to value right before subscription and no observable is kept in queue.
+ * Source observable is the only producer of queue (emissions of observable are serialized) and drainer is the only consumer, so queue needs no lock.
+ *
+ * Same as in rpp::source::concat, drainer links rpp::details::concat_drain_frame to stack of current thread during subscribe: inner observable
+ * completed synchronously inside of it just marks frame and drainer goes on with the next value without atomic read-modify-write and without recursion.
+ */
+template<rpp::constraint::decayed_type SourceType, rpp::constraint::decayed_type Type, rpp::constraint::decayed_type Fn, rpp::constraint::observer TObserver>
+class concat_map_disposable final : public rpp::base_disposable
+{
+    struct subscribe_frame final : rpp::details::concat_drain_frame
+    {
+        bool inner_completed{};
+    };
+
+public:
+    using value_type = Type;
+
+    concat_map_disposable(TObserver&& observer, const Fn& fn)
+        : m_emitter{std::move(observer)}
+        , m_fn{fn} {}
+
+    static std::shared_ptr<concat_map_disposable> create(TObserver&& observer, const Fn& fn)
+    {
+        auto state = std::make_shared<concat_map_disposable>(std::move(observer), fn);
+        state->add(state->m_inner_slot);
+        state->m_emitter.get_observer().set_upstream(weak_disposable::make(state));
+        return state;
+    }
+
+    template<typename T>
+    void on_next_source(const std::shared_ptr<concat_map_disposable>& self, T&& v)
+    {
+        size_t expected{};
+        if (m_wip.load(std::memory_order_relaxed) == 0 && m_wip.compare_exchange_strong(expected, 1, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            // source is the only producer of queue, so nobody can add value in parallel: nothing to keep order with
+            // owner of `m_wip` is consumer of queue
+            if (!m_inner_active.load(std::memory_order_acquire) && m_queue.empty())
+            {
+                if (!is_disposed())
+                    subscribe_inner(self, std::forward<T>(v));
+            }
+            else
+            {
+                enqueue(std::forward<T>(v));
+            }
+
+            drain(self, 1);
+            return;
+        }
+
+        enqueue(std::forward<T>(v));
+        request_drain(self);
+    }
+
+    void on_source_completed(const std::shared_ptr<concat_map_disposable>& self)
+    {
+        m_source_completed.store(true, std::memory_order_release);
+        request_drain(self);
+    }
+
+    template<typename T>
+    void on_next(T&& v)
+    {
+        m_emitter.on_next(std::forward<T>(v));
+    }
+
+    void on_error(const std::exception_ptr& err)
+    {
+        m_emitter.on_error(err);
+        dispose();
+    }
+
+    void set_inner_upstream(const disposable_wrapper& d) { m_inner_slot->set_upstream(d); }
+
+    void on_inner_completed(const std::shared_ptr<concat_map_disposable>& self, const rpp::details::concat_drain_frame::key& frame_key)
+    {
+        m_inner_slot->reset();
+
+        if (auto* frame = rpp::details::concat_drain_frame::find_active(frame_key))
+        {
+            static_cast<subscribe_frame&>(*frame).inner_completed = true;
+            return;
+        }
+
+        m_inner_active.store(false, std::memory_order_release);
+        request_drain(self);
+    }
+
+private:
+    template<typename T>
+    void enqueue(T&& v)
+    {
+        m_queue.push(std::forward<T>(v));
+    }
+
+    void request_drain(const std::shared_ptr<concat_map_disposable>& self)
+    {
+        if (m_wip.fetch_add(1, std::memory_order_acq_rel) == 0)
+            drain(self, 1);
+    }
+
+    void drain(const std::shared_ptr<concat_map_disposable>& self, size_t missed)
+    {
+        while (true)
+        {
+            while (!is_disposed() && !m_inner_active.load(std::memory_order_acquire))
+            {
+                // flag is read before queue: all values are enqueued before completion of source
+                const bool source_completed = m_source_completed.load(std::memory_order_acquire);
+                if (m_queue.empty())
+                {
+                    if (source_completed)
+                    {
+                        m_emitter.on_completed();
+                        dispose();
+                    }
+                    break;
+                }
+
+                subscribe_inner(self, m_queue.pop());
+            }
+
+            missed = m_wip.fetch_sub(missed, std::memory_order_acq_rel) - missed;
+            if (missed == 0)
+                return;
+        }
+    }
+
+    template<typename T>
+    void subscribe_inner(const std::shared_ptr<concat_map_disposable>& self, T&& v);
+
+private:
+    serialized_emitter<Type, TObserver>            m_emitter;
+    RPP_NO_UNIQUE_ADDRESS Fn                       m_fn;
+    const std::shared_ptr<inner_subscription_slot> m_inner_slot = std::make_shared<inner_subscription_slot>();
+
+    std::atomic<size_t> m_wip{};
+    std::atomic<bool>   m_inner_active{};
+    std::atomic<bool>   m_source_completed{};
+
+    spsc_queue<SourceType> m_queue{};
+};
+
+/**
+ * @brief Observer passing values of inner observables to shared state. One such lightweight observer (just pointer to state) is created per inner observable.
+ * @details State is kept alive by rpp::operators::details::concat_map_inner_observer_strategy living next to this observer.
+ */
+template<typename State>
+struct concat_map_forwarding_observer_strategy
+{
+    using Type = typename State::value_type;
+
+    State* state;
+
+    void on_next(const Type& v) const { state->on_next(v); }
+    void on_next(Type&& v) const { state->on_next(std::move(v)); }
+    void on_error(const std::exception_ptr& err) const { state->on_error(err); }
+    void on_completed() const {}
+
+    void set_upstream(const disposable_wrapper&) const {}
+    bool is_disposed() const { return state->is_disposed(); }
+};
+
+template<typename State>
+struct concat_map_inner_observer_strategy
+{
+    std::shared_ptr<State>                state;
+    rpp::details::concat_drain_frame::key frame_key;
+
+    constexpr static forwarding_on_next_strategy on_next{};
+    constexpr static forwarding_on_error_strategy on_error{};
+    constexpr static forwarding_is_disposed_strategy is_disposed{};
+
+    void set_upstream(const rpp::constraint::observer auto&, const disposable_wrapper& d) const { state->set_inner_upstream(d); }
+    void on_completed(const rpp::constraint::observer auto&) const { state->on_inner_completed(state, frame_key); }
+};
+
+template<rpp::constraint::decayed_type SourceType, rpp::constraint::decayed_type Type, rpp::constraint::decayed_type Fn, rpp::constraint::observer TObserver>
+template<typename T>
+void concat_map_disposable<SourceType, Type, Fn, TObserver>::subscribe_inner(const std::shared_ptr<concat_map_disposable>& self, T&& v)
+{
+    using forwarding_observer = base_observer<Type, concat_map_forwarding_observer_strategy<concat_map_disposable>>;
+
+    RPP_TRY
+    {
+        auto observable = m_fn(std::forward<T>(v));
+
+        m_inner_active.store(true, std::memory_order_relaxed);
+
+        subscribe_frame frame{};
+        std::move(observable).subscribe(base_observer<Type, operator_strategy_base<Type, forwarding_observer, concat_map_inner_observer_strategy<concat_map_disposable>>>{
+            forwarding_observer{this},
+            self,
+            frame.get_key()});
+
+        // completed synchronously -> nobody else knows about it, so the next value can be subscribed right now
+        if (frame.inner_completed)
+            m_inner_active.store(false, std::memory_order_relaxed);
+    }
+    RPP_CATCH(...)
+    {
+        on_error(std::current_exception());
+    }
+}
+
+template<typename State>
+struct concat_map_observer_strategy
+{
+    std::shared_ptr<State> state;
+
+    template<typename T>
+    void on_next(T&& v) const
+    {
+        state->on_next_source(state, std::forward<T>(v));
+    }
+
+    void on_error(const std::exception_ptr& err) const { state->on_error(err); }
+    void on_completed() const { state->on_source_completed(state); }
+
+    void set_upstream(const disposable_wrapper& d) const { state->add(d.get_original()); }
+    bool is_disposed() const { return state->is_disposed(); }
+};
+
+template<rpp::constraint::observable TObservable, rpp::constraint::decayed_type Fn>
+struct concat_map_observable_strategy
+{
+    using SourceType      = rpp::utils::extract_observable_type_t<TObservable>;
+    using InnerObservable = std::decay_t<std::invoke_result_t<Fn, SourceType>>;
+    using Type            = rpp::utils::extract_observable_type_t<InnerObservable>;
+
+    RPP_NO_UNIQUE_ADDRESS TObservable observable;
+    RPP_NO_UNIQUE_ADDRESS Fn          fn;
+
+    template<rpp::constraint::observer_strategy<Type> Strategy>
+    void subscribe(base_observer<Type, Strategy>&& observer) const
+    {
+        using state_t = concat_map_disposable<SourceType, Type, Fn, base_observer<Type, Strategy>>;
+
+        observable.subscribe(base_observer<SourceType, concat_map_observer_strategy<state_t>>{state_t::create(std::move(observer), fn)});
+    }
+};
+
+template<rpp::constraint::decayed_type Fn>
+struct concat_map_t
+{
+    RPP_NO_UNIQUE_ADDRESS Fn fn;
+
+    template<rpp::constraint::observable TObservable>
+        requires (std::invocable<Fn, rpp::utils::extract_observable_type_t<TObservable>> && rpp::constraint::observable<std::invoke_result_t<Fn, rpp::utils::extract_observable_type_t<TObservable>>>)
+    auto operator()(TObservable&& observable) const
+    {
+        using strategy = concat_map_observable_strategy<std::decay_t<TObservable>, Fn>;
+        return rpp::base_observable<typename strategy::Type, strategy>{std::forward<TObservable>(observable), fn};
+    }
+};
+}
+
+namespace rpp::operators
+{
+/**
+ * @brief Transforms each item emitted by observable into observable via provided callable and emits values of such observables one after another:
+ * next observable is subscribed only after completion of previous one.
+ *
+ * @marble concat_map
+     {
+         source observable                       : +--1--2--3--|
+         operator "concat_map: x=>just(x,x+10)" : +--(1,11)-(2,12)-(3,13)-|
+     }
+ *
+ * @details Actually it is `map(callable) | concat()`, but callable is applied lazily: items emitted by source observable while some inner observable
+ * is active are kept in queue and transformed right before subscription to the corresponding observable. Resulting observable completes when source
+ * observable and all inner observables are completed. Any error is passed immediately and disposes everything.
+ *
+ * @par Performance notes:
+ * - Waiting items are kept in lock-free single-producer/single-consumer queue of fixed-size segments: no allocation per item and no lock
+ * - While no inner observable is active, item is transformed and subscribed directly by thread of source observable
+ * - Inner observable completed synchronously doesn't cause recursive subscription of the next one and doesn't need any atomic read-modify-write
+ * - No disposable is allocated per inner observable: disposable of active inner observable is kept in one reusable slot
+ *
+ * @param callable is callable used to transform each item into observable. Should accept `Type` of original observable and return observable
+ * @warning #include <rpp/operators/concat_map.hpp>
+ *
+ * @par Example:
+ * @snippet concat_map.cpp concat_map
+ *
+ * @ingroup transforming_operators
+ * @see https://reactivex.io/documentation/operators/flatmap.html
+ */
+template<typename Fn>
+    requires (!utils::is_not_template_callable<Fn> || rpp::constraint::observable<std::invoke_result_t<Fn, utils::convertible_to_any>>)
+auto concat_map(Fn&& callable)
+{
+    return details::concat_map_t<std::decay_t<Fn>>{std::forward<Fn>(callable)};
+}
+} // namespace rpp::operators
@@ -0,0 +1,75 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/disposables/base_disposable.hpp>
+#include <rpp/disposables/disposable_wrapper.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <utility>
+
+namespace rpp::operators::details
+{
+/**
+ * @brief Reusable place of one active inner subscription of operators like flat_map/concat_map: keeps disposable of inner observable to dispose it with
+ * the whole subscription.
+ * @details Slot is added to state of operator once and then reused by all inner observables subscribed in it one after another, so starting of new inner
+ * observable doesn't allocate any disposable and doesn't grow list of children of the state.
+ */
+class inner_subscription_slot final : public rpp::base_disposable
+{
+public:
+    void set_upstream(const disposable_wrapper& d)
+    {
+        {
+            std::lock_guard lock{m_mutex};
+            if (!is_disposed())
+            {
+                m_upstream = d;
+                m_has_upstream.store(true, std::memory_order_relaxed);
+                return;
+            }
+        }
+        d.dispose();
+    }
+
+    void reset()
+    {
+        // most of synchronous sources never set upstream, so no need to lock for them
+        if (!m_has_upstream.load(std::memory_order_relaxed))
+            return;
+
+        std::lock_guard lock{m_mutex};
+        m_upstream = disposable_wrapper{};
+        m_has_upstream.store(false, std::memory_order_relaxed);
+    }
+
+    // intrusive link of stack of free slots
+    inner_subscription_slot* next_free{};
+
+private:
+    void dispose_impl() override
+    {
+        disposable_wrapper upstream{};
+        {
+            std::lock_guard lock{m_mutex};
+            upstream = std::exchange(m_upstream, disposable_wrapper{});
+        }
+        upstream.dispose();
+    }
+
+private:
+    std::mutex         m_mutex{};
+    disposable_wrapper m_upstream{};
+    std::atomic<bool>  m_has_upstream{};
+};
+} // namespace rpp::operators::details
@@ -0,0 +1,121 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/observers/fwd.hpp>
+#include <rpp/utils/constraints.hpp>
+#include <rpp/utils/mpsc_queue.hpp>
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace rpp::operators::details
+{
+/**
+ * @brief Serializes emissions from several threads to one observer without locks ("emitter loop" / queue-drain).
+ * @details Thread which moves `wip` from 0 becomes the only emitter: it emits own event in place and then drains events queued by other threads meanwhile.
+ * Threads which find emitter active just place event to rpp::details::mpsc_queue and return immediately, so nobody waits for anybody.
+ * Without contention no queue (and no allocation) is used at all.
+ */
+template<rpp::constraint::decayed_type Type, rpp::constraint::observer TObserver>
+class serialized_emitter
+{
+    struct error_event
+    {
+        std::exception_ptr err;
+    };
+
+    struct completed_event
+    {
+    };
+
+    using event = std::variant<Type, error_event, completed_event>;
+
+public:
+    explicit serialized_emitter(TObserver&& observer)
+        : m_observer{std::move(observer)} {}
+
+    serialized_emitter(const serialized_emitter&) = delete;
+    serialized_emitter(serialized_emitter&&)      = delete;
+
+    /**
+     * @brief Original observer. Have to be used directly only before any emission (for example, to set upstream).
+     */
+    TObserver& get_observer() { return m_observer; }
+
+    bool is_disposed() const { return m_observer.is_disposed(); }
+
+    template<typename T>
+    void on_next(T&& v)
+    {
+        emit_serialized(std::in_place_type<Type>, std::forward<T>(v));
+    }
+
+    void on_error(const std::exception_ptr& err) { emit_serialized(std::in_place_type<error_event>, err); }
+
+    void on_completed() { emit_serialized(std::in_place_type<completed_event>); }
+
+private:
+    template<typename E, typename... Args>
+    void emit_serialized(std::in_place_type_t<E> tag, Args&&... args)
+    {
+        size_t expected{};
+        if (m_wip.load(std::memory_order_relaxed) == 0 && m_wip.compare_exchange_strong(expected, 1, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            if constexpr (std::same_as<E, Type>)
+                m_observer.on_next(std::forward<Args>(args)...);
+            else
+                emit(E{std::forward<Args>(args)...});
+
+            // somebody queued events while we were emitting: we are still the only emitter
+            if (const auto missed = m_wip.fetch_sub(1, std::memory_order_acq_rel) - 1; missed != 0)
+                drain(missed);
+            return;
+        }
+
+        m_queue.emplace(tag, std::forward<Args>(args)...);
+        if (m_wip.fetch_add(1, std::memory_order_acq_rel) == 0)
+            drain(1);
+    }
+
+    void drain(size_t missed)
+    {
+        while (true)
+        {
+            while (m_queue.pop_to([this](event&& e) { std::visit([this](auto&& v) { emit(std::forward<decltype(v)>(v)); }, std::move(e)); })) {}
+
+            missed = m_wip.fetch_sub(missed, std::memory_order_acq_rel) - missed;
+            if (missed == 0)
+                return;
+        }
+    }
+
+    template<typename T>
+        requires std::same_as<std::decay_t<T>, Type>
+    void emit(T&& v)
+    {
+        m_observer.on_next(std::forward<T>(v));
+    }
+
+    void emit(error_event&& e) { m_observer.on_error(e.err); }
+    void emit(completed_event&&) { m_observer.on_completed(); }
+
+private:
+    TObserver                       m_observer;
+    std::atomic<size_t>             m_wip{};
+    rpp::details::mpsc_queue<event> m_queue{};
+};
+} // namespace rpp::operators::details
@@ -0,0 +1,197 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/details/strategy.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace rpp::operators::details
+{
+/**
+ * @brief Unbounded lock-free single-producer/single-consumer FIFO queue of values placed to linked list of fixed-size segments.
+ * @details Producer fills tail segment and publishes amount of written values via release store, consumer reads values of head segment till this
+ * amount. Next segment is linked only when current one is full, so consumer moves to the next segment only after taking all values of current one.
+ *
+ * Segment taken completely by consumer is kept as spare and reused by producer for the next segment: steady stream of values doesn't allocate at all,
+ * only growth of queue does (one allocation per segment).
+ *
+ * Values of rpp::operators::details::batch_bufferable types are stored in place, so values of one segment can be passed downstream as contiguous span.
+ * Other values are stored in `std::optional` to be constructed/destroyed exactly when pushed/popped.
+ *
+ * @tparam SegmentCapacity amount of values in one segment
+ * @warning `push` have to be called by one producer at a time, `empty`/`pop`/`consume` by one consumer at a time.
+ */
+template<typename T, size_t SegmentCapacity = 32>
+class spsc_queue
+{
+    static constexpr size_t s_cache_line_size  = 64;
+    static constexpr size_t s_segment_capacity = SegmentCapacity;
+
+public:
+    static constexpr bool stores_values_in_place = batch_bufferable<T>;
+
+    using slot_type = std::conditional_t<stores_values_in_place, T, std::optional<T>>;
+
+private:
+    struct segment
+    {
+        std::array<slot_type, s_segment_capacity> slots{};
+        std::atomic<size_t>                       produced{};
+        std::atomic<segment*>                     next{};
+    };
+
+public:
+    spsc_queue() = default;
+
+    spsc_queue(const spsc_queue&) = delete;
+    spsc_queue(spsc_queue&&)      = delete;
+
+    ~spsc_queue() noexcept
+    {
+        auto* current = m_head ? m_head : m_first.load(std::memory_order_relaxed);
+        while (current)
+            delete std::exchange(current, current->next.load(std::memory_order_relaxed));
+        delete m_spare.load(std::memory_order_relaxed);
+    }
+
+    template<typename U>
+    void push(U&& v)
+    {
+        if (!m_tail)
+        {
+            m_tail = acquire_segment();
+            m_first.store(m_tail, std::memory_order_release);
+        }
+        else if (m_produced == s_segment_capacity)
+        {
+            auto* next = acquire_segment();
+            m_tail->next.store(next, std::memory_order_release);
+            m_tail     = next;
+            m_produced = 0;
+        }
+
+        auto& slot = m_tail->slots[m_produced];
+        if constexpr (stores_values_in_place)
+            slot = std::forward<U>(v);
+        else
+            slot.emplace(std::forward<U>(v));
+        m_tail->produced.store(++m_produced, std::memory_order_release);
+    }
+
+    /**
+     * @brief Checks if there is any value visible to consumer. Frees segment taken completely by consumer.
+     */
+    bool empty()
+    {
+        if (!m_head)
+        {
+            m_head = m_first.load(std::memory_order_acquire);
+            if (!m_head)
+                return true;
+        }
+
+        if (m_consumed == s_segment_capacity)
+        {
+            auto* next = m_head->next.load(std::memory_order_acquire);
+            if (!next)
+                return true;
+
+            release_segment(std::exchange(m_head, next));
+            m_consumed = 0;
+        }
+        return m_consumed == m_head->produced.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Takes the oldest value out of queue. Queue must not be empty (see `empty`).
+     */
+    T pop()
+    {
+        auto& slot = m_head->slots[m_consumed++];
+        if constexpr (stores_values_in_place)
+            return slot;
+        else
+        {
+            T v = std::move(slot).value();
+            slot.reset();
+            return v;
+        }
+    }
+
+    /**
+     * @brief Passes up to `limit` values visible to consumer to `fn` by contiguous chunks of slots and takes them out of queue. Returns amount of taken values.
+     * @details `fn` accepts `std::span<slot_type>` and returns false to stop consuming: the rest of values stay in queue.
+     */
+    template<typename Fn>
+    size_t consume(size_t limit, Fn&& fn)
+    {
+        size_t consumed{};
+        while (consumed < limit && !empty())
+        {
+            const auto count = std::min(limit - consumed, m_head->produced.load(std::memory_order_acquire) - m_consumed);
+
+            const std::span<slot_type> chunk{m_head->slots.data() + m_consumed, count};
+            m_consumed += count;
+            consumed += count;
+
+            const bool proceed = fn(chunk);
+
+            if constexpr (!stores_values_in_place)
+            {
+                for (auto& slot : chunk)
+                    slot.reset();
+            }
+
+            if (!proceed)
+                break;
+        }
+        return consumed;
+    }
+
+private:
+    segment* acquire_segment()
+    {
+        if (auto* spare = m_spare.exchange(nullptr, std::memory_order_acquire))
+        {
+            spare->produced.store(0, std::memory_order_relaxed);
+            spare->next.store(nullptr, std::memory_order_relaxed);
+            return spare;
+        }
+        return new segment{};
+    }
+
+    void release_segment(segment* s)
+    {
+        // only one spare segment is kept: memory of grown queue is returned once consumer catches up
+        delete m_spare.exchange(s, std::memory_order_acq_rel);
+    }
+
+private:
+    std::atomic<segment*> m_first{};
+    std::atomic<segment*> m_spare{};
+
+    // producer's side
+    alignas(s_cache_line_size) segment* m_tail{};
+    size_t                              m_produced{};
+
+    // consumer's side
+    alignas(s_cache_line_size) segment* m_head{};
+    size_t                              m_consumed{};
+};
+} // namespace rpp::operators::details
@@ -17,8 +17,15 @@
 #include <rpp/observables/base_observable.hpp>
 #include <rpp/utils/constraints.hpp>
 
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
 #include <exception>
 #include <functional>
+#include <limits>
+#include <span>
+#include <tuple>
+#include <type_traits>
 #include <variant>
 
 
@@ -41,9 +48,86 @@ concept operator_strategy = requires(const S& const_strategy,
     strategy.set_upstream(observer, disposable);
     { strategy.is_disposed() } -> std::same_as<bool>;
 };
+
+/**
+ * @brief Operator's strategy which keeps no state per subscription and forwards everything except of on_next. Consecutive operators with such
+ * strategies are fused into one rpp::operators::details::fused_observer_strategy.
+ * @details on_next of such strategy should accept any object providing `on_next` and `on_completed`, not only rpp::base_observer
+ */
+template<typename S>
+concept fusable_strategy = rpp::constraint::decayed_type<S> && std::copy_constructible<S> && S::is_fusable;
 }
 namespace rpp::operators::details
 {
+/**
+ * @brief Operator's strategy can provide `template<typename T, typename TObs> static constexpr bool is_nothrow_on_next` to mark its on_next for such types
+ * as noexcept, so observers can skip try/catch around it. It is not deduced from on_next itself to avoid instantiation of user's callbacks with
+ * unexpected types during checking of rpp::operators::details::constraint::operator_strategy.
+ */
+template<typename Strategy, typename T, typename TObs>
+inline constexpr bool is_nothrow_on_next_v = false;
+
+template<typename Strategy, typename T, typename TObs>
+    requires requires { { Strategy::template is_nothrow_on_next<T, TObs> } -> std::convertible_to<bool>; }
+inline constexpr bool is_nothrow_on_next_v<Strategy, T, TObs> = Strategy::template is_nothrow_on_next<T, TObs>;
+
+/**
+ * @brief Amount of values processed at once by operators which need local buffer to pass batch of values downstream.
+ */
+inline constexpr size_t batch_chunk_size = 256;
+
+/**
+ * @brief Values of such type can be collected to local buffer to be passed downstream as batch.
+ */
+template<typename T>
+concept batch_bufferable = std::is_trivially_copyable_v<T> && std::is_trivially_default_constructible_v<T>;
+
+/**
+ * @brief Observer handles batch of values natively, so it is worth to collect values to local buffer for it. Otherwise values are passed one by one directly.
+ */
+template<typename TObs>
+concept batch_native_observer = requires { requires TObs::has_native_batch; };
+
+/**
+ * @brief Amount of values `obs` processes for sure (see rpp::constraint::observer_strategy_with_batch_demand). At least 1 to let batch make progress.
+ */
+template<typename TObs>
+size_t get_batch_demand(const TObs& obs)
+{
+    if constexpr (requires { { obs.batch_demand() } -> std::convertible_to<size_t>; })
+        return std::max<size_t>(obs.batch_demand(), 1);
+    else
+        return std::numeric_limits<size_t>::max();
+}
+
+/**
+ * @brief Demand of operator's strategy for values of its upstream: strategy can override it via `batch_demand(obs)`, otherwise it is demand of
+ * downstream observer. It is valid for any strategy emitting no more values than it obtains (like map/filter).
+ */
+template<typename Strategy, typename TObs>
+size_t get_strategy_batch_demand(const Strategy& strategy, const TObs& obs)
+{
+    if constexpr (requires { { strategy.batch_demand(obs) } -> std::convertible_to<size_t>; })
+        return std::max<size_t>(strategy.batch_demand(obs), 1);
+    else
+        return get_batch_demand(obs);
+}
+
+/**
+ * @brief Fallback for strategies without native handling of batch: passes values to on_next of strategy one by one till observer is disposed.
+ */
+template<typename Strategy, typename TObs, typename T>
+void on_next_each(const Strategy& strategy, const TObs& obs, std::span<const T> values)
+{
+    for (const auto& v : values)
+    {
+        if (obs.is_disposed())
+            return;
+
+        strategy.on_next(obs, v);
+    }
+}
+
 template<rpp::constraint::decayed_type T, rpp::constraint::observer TObs, constraint::operator_strategy<rpp::utils::extract_observer_type_t<T>> Strategy>
 class operator_strategy_base;
 
@@ -71,13 +155,21 @@ public:
     ~operator_strategy_base() noexcept = default;
 
     void set_upstream(const disposable_wrapper& d)     { m_strategy.set_upstream(m_observer, d); }
-    bool is_disposed() const                           { return m_strategy.is_disposed() || m_observer.is_disposed(); }
+    bool is_disposed() const noexcept(noexcept(m_strategy.is_disposed()) && noexcept(m_observer.is_disposed())) { return m_strategy.is_disposed() || m_observer.is_disposed(); }
 
-    void on_next(const T& v) const                     { m_strategy.on_next(m_observer, v); }
-    void on_next(T&& v) const                          { m_strategy.on_next(m_observer, std::move(v)); }
+    void on_next(const T& v) const noexcept(is_nothrow_on_next_v<Strategy, const T&, observer>) { m_strategy.on_next(m_observer, v); }
+    void on_next(T&& v) const noexcept(is_nothrow_on_next_v<Strategy, T&&, observer>)          { m_strategy.on_next(m_observer, std::move(v)); }
     void on_error(const std::exception_ptr& err) const { m_strategy.on_error(m_observer, err); }
     void on_completed() const                          { m_strategy.on_completed(m_observer); }
 
+    void on_next_batch(std::span<const T> values) const
+        requires requires(const Strategy& strategy, const observer& obs) { strategy.on_next_batch(obs, values); }
+    {
+        m_strategy.on_next_batch(m_observer, values);
+    }
+
+    size_t batch_demand() const { return get_strategy_batch_demand(m_strategy, m_observer); }
+
 private:
     mutable observer               m_observer;
     RPP_NO_UNIQUE_ADDRESS Strategy m_strategy;
@@ -86,7 +178,7 @@ private:
 struct forwarding_on_next_strategy
 {
     template<typename T>
-    void operator()(const rpp::constraint::observer auto& obs, T&& v) const
+    void operator()(const rpp::constraint::observer auto& obs, T&& v) const noexcept(requires { { obs.on_next(std::forward<T>(v)) } noexcept; })
     {
         obs.on_next(std::forward<T>(v));
     }
@@ -116,9 +208,128 @@ struct forwarding_set_upstream_strategy
 
 struct forwarding_is_disposed_strategy
 {
-    bool operator()() const {return false; }
+    bool operator()() const noexcept { return false; }
+};
+
+/**
+ * @brief Strategy of several fused operators: runs on_next of stages back to back inside one observer instead of chain of observers (one per operator).
+ * @details Each stage obtains lightweight `stage_observer` passing result of stage directly to the next stage. Last stage passes it to the original observer.
+ * Exceptions of any stage are handled by the only observer of this strategy and passed to on_error of original observer.
+ */
+template<constraint::fusable_strategy... Stages>
+class fused_observer_strategy
+{
+    template<size_t I, typename TObs>
+    struct stage_observer;
+
+    template<size_t I, typename T, typename TObs>
+    static constexpr bool is_nothrow_from()
+    {
+        if constexpr (I == sizeof...(Stages))
+            return requires(const TObs& obs, T&& v) { { obs.on_next(std::forward<T>(v)) } noexcept; };
+        else
+            return is_nothrow_on_next_v<std::tuple_element_t<I, std::tuple<Stages...>>, T, stage_observer<I + 1, TObs>>;
+    }
+
+    template<size_t I, typename TObs>
+    struct stage_observer
+    {
+        // stages pass values to each other directly anyway, so it is worth to collect them only if original observer handles batch natively
+        static constexpr bool has_native_batch = batch_native_observer<TObs>;
+
+        const fused_observer_strategy& strategy;
+        const TObs&                    observer;
+
+        template<typename T>
+        void on_next(T&& v) const noexcept(is_nothrow_from<I, T&&, TObs>())
+        {
+            strategy.template on_next_from<I>(observer, std::forward<T>(v));
+        }
+
+        template<typename T>
+        void on_next_batch(std::span<const T> values) const
+        {
+            strategy.template on_next_batch_from<I>(observer, values);
+        }
+
+        void on_completed() const { observer.on_completed(); }
+
+        bool is_disposed() const { return observer.is_disposed(); }
+
+        size_t batch_demand() const { return strategy.template batch_demand_from<I>(observer); }
+    };
+
+public:
+    explicit fused_observer_strategy(const Stages&... stages)
+        : m_stages{stages...} {}
+
+    template<typename T, typename TObs>
+    static constexpr bool is_nothrow_on_next = is_nothrow_from<0, T, TObs>();
+
+    template<typename T>
+    void on_next(const rpp::constraint::observer auto& obs, T&& v) const
+    {
+        on_next_from<0>(obs, std::forward<T>(v));
+    }
+
+    template<typename T>
+    void on_next_batch(const rpp::constraint::observer auto& obs, std::span<const T> values) const
+    {
+        on_next_batch_from<0>(obs, values);
+    }
+
+    size_t batch_demand(const rpp::constraint::observer auto& obs) const { return batch_demand_from<0>(obs); }
+
+    constexpr static forwarding_on_error_strategy on_error{};
+    constexpr static forwarding_on_completed_strategy on_completed{};
+    constexpr static forwarding_set_upstream_strategy set_upstream{};
+    constexpr static forwarding_is_disposed_strategy is_disposed{};
+
+private:
+    template<size_t I, typename TObs, typename T>
+    void on_next_from(const TObs& obs, T&& v) const
+    {
+        if constexpr (I == sizeof...(Stages))
+            obs.on_next(std::forward<T>(v));
+        else
+            std::get<I>(m_stages).on_next(stage_observer<I + 1, TObs>{*this, obs}, std::forward<T>(v));
+    }
+
+    template<size_t I, typename TObs>
+    size_t batch_demand_from(const TObs& obs) const
+    {
+        if constexpr (I == sizeof...(Stages))
+            return get_batch_demand(obs);
+        else
+            return get_strategy_batch_demand(std::get<I>(m_stages), stage_observer<I + 1, TObs>{*this, obs});
+    }
+
+    template<size_t I, typename TObs, typename T>
+    void on_next_batch_from(const TObs& obs, std::span<const T> values) const
+    {
+        if constexpr (I == sizeof...(Stages))
+            obs.on_next_batch(values);
+        else
+        {
+            const auto&                       stage = std::get<I>(m_stages);
+            const stage_observer<I + 1, TObs> next{*this, obs};
+            if constexpr (requires { stage.on_next_batch(next, values); })
+                stage.on_next_batch(next, values);
+            else
+                on_next_each(stage, next, values);
+        }
+    }
+
+private:
+    RPP_NO_UNIQUE_ADDRESS std::tuple<Stages...> m_stages;
 };
 
+template<typename S>
+struct is_fused_observer_strategy : std::false_type {};
+
+template<typename... Stages>
+struct is_fused_observer_strategy<fused_observer_strategy<Stages...>> : std::true_type {};
+
 template<rpp::constraint::observable Observable,
          rpp::constraint::decayed_type T,
          constraint::operator_strategy<rpp::utils::extract_observable_type_t<Observable>> Strategy,
@@ -137,6 +348,33 @@ public:
         : m_observable{std::move(observable)}
         , m_vals{std::forward<TArgs>(args)...} {}
 
+    /**
+     * @brief Fuses operator applied to this observable with operator of this observable: resulting observable subscribes to the same original observable
+     * with one rpp::operators::details::fused_observer_strategy instead of wrapping observer per each operator.
+     * @details Available only when both strategies are rpp::operators::details::constraint::fusable_strategy and `op` provides `as_stage()`.
+     */
+    template<typename Op>
+        requires (constraint::fusable_strategy<Strategy> || is_fused_observer_strategy<Strategy>::value) && requires(Op&& op) { { std::forward<Op>(op).as_stage() } -> constraint::fusable_strategy; }
+    auto fuse(Op&& op) const&
+    {
+        return std::apply([&](const auto&... stages)
+                          {
+                              return make_fused<std::invoke_result_t<Op, const rpp::base_observable<T, operator_observable_strategy>&>>(m_observable, stages..., std::forward<Op>(op).as_stage());
+                          },
+                          get_stages());
+    }
+
+    template<typename Op>
+        requires (constraint::fusable_strategy<Strategy> || is_fused_observer_strategy<Strategy>::value) && requires(Op&& op) { { std::forward<Op>(op).as_stage() } -> constraint::fusable_strategy; }
+    auto fuse(Op&& op) &&
+    {
+        return std::apply([&](auto&&... stages)
+                          {
+                              return make_fused<std::invoke_result_t<Op, rpp::base_observable<T, operator_observable_strategy>&&>>(std::move(m_observable), std::move(stages)..., std::forward<Op>(op).as_stage());
+                          },
+                          get_stages());
+    }
+
     template<rpp::constraint::observer_strategy<T> ObserverStrategy>
     void subscribe(base_observer<T, ObserverStrategy>&& observer) const
     {
@@ -148,6 +386,25 @@ public:
                   m_vals);
     }
 
+private:
+    // fused strategy is constructed from its stages, while single stage is constructed from arguments of its operator
+    auto get_stages() const
+    {
+        if constexpr (is_fused_observer_strategy<Strategy>::value)
+            return m_vals;
+        else
+            return std::tuple{std::apply([](const Args&... vals) { return Strategy{vals...}; }, m_vals)};
+    }
+
+    template<rpp::constraint::observable ResultObservable, typename TObservable, typename... Stages>
+    static auto make_fused(TObservable&& observable, Stages&&... stages)
+    {
+        using fused_strategy = fused_observer_strategy<std::decay_t<Stages>...>;
+        return rpp::base_observable<rpp::utils::extract_observable_type_t<ResultObservable>,
+                                    operator_observable_strategy<Observable, rpp::utils::extract_observable_type_t<ResultObservable>, fused_strategy, std::decay_t<Stages>...>>{std::forward<TObservable>(observable),
+                                                                                                                                                                            std::forward<Stages>(stages)...};
+    }
+
 private:
     RPP_NO_UNIQUE_ADDRESS Observable          m_observable;
     RPP_NO_UNIQUE_ADDRESS std::tuple<Args...> m_vals{};
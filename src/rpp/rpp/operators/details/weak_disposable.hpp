@@ -0,0 +1,46 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/disposables/base_disposable.hpp>
+#include <rpp/disposables/disposable_wrapper.hpp>
+
+#include <memory>
+
+namespace rpp::operators::details
+{
+/**
+ * @brief Disposable which disposes target only if target is still alive, but doesn't keep it alive.
+ * @details Used as upstream of original observer owned by shared state of operator: passing state itself would create reference cycle
+ * "state -> observer -> state", so state would never be destroyed. State is kept alive by observers of sources and scheduled actions instead.
+ */
+class weak_disposable final : public rpp::base_disposable
+{
+public:
+    explicit weak_disposable(const std::shared_ptr<base_disposable>& target)
+        : m_target{target} {}
+
+    static disposable_wrapper make(const std::shared_ptr<base_disposable>& target)
+    {
+        return disposable_wrapper{std::make_shared<weak_disposable>(target)};
+    }
+
+private:
+    void dispose_impl() override
+    {
+        if (const auto target = m_target.lock())
+            target->dispose();
+    }
+
+private:
+    std::weak_ptr<base_disposable> m_target;
+};
+} // namespace rpp::operators::details
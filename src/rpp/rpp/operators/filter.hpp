@@ -14,6 +14,11 @@
 #include <rpp/defs.hpp>
 #include <rpp/operators/details/strategy.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <span>
 #include <type_traits>
 
 namespace rpp::operators::details
@@ -23,17 +28,59 @@ struct filter_observer_strategy
 {
     RPP_NO_UNIQUE_ADDRESS Fn fn;
 
+    template<typename T, typename TObs>
+    static constexpr bool is_nothrow_on_next = requires(const Fn& fn, T&& v, const TObs& obs) { { fn(rpp::utils::as_const(v)) } noexcept; { obs.on_next(std::forward<T>(v)) } noexcept; };
+
     template<typename T>
-    void on_next(const rpp::constraint::observer auto& obs, T&& v) const
+    void on_next(const auto& obs, T&& v) const
     {
         if (fn(rpp::utils::as_const(v)))
             obs.on_next(std::forward<T>(v));
     }
 
+    template<typename T, typename TObs>
+    void on_next_batch(const TObs& obs, std::span<const T> values) const
+    {
+        if constexpr (batch_bufferable<T> && batch_native_observer<TObs>)
+        {
+            std::array<T, batch_chunk_size> passed;
+            for (size_t offset = 0; offset < values.size() && !obs.is_disposed();)
+            {
+                // predicate is not invoked for values after the last one downstream accepts
+                const auto demand = std::min(passed.size(), get_batch_demand(obs));
+
+                size_t count{};
+                RPP_TRY
+                {
+                    for (; offset < values.size() && count < demand; ++offset)
+                    {
+                        passed[count] = values[offset];
+                        count += static_cast<bool>(fn(values[offset]));
+                    }
+                }
+                RPP_CATCH(...)
+                {
+                    if (count != 0)
+                        obs.on_next_batch(std::span<const T>{passed.data(), count});
+                    std::rethrow_exception(std::current_exception());
+                }
+
+                if (count != 0)
+                    obs.on_next_batch(std::span<const T>{passed.data(), count});
+            }
+        }
+        else
+        {
+            on_next_each(*this, obs, values);
+        }
+    }
+
     constexpr static forwarding_on_error_strategy on_error{};
     constexpr static forwarding_on_completed_strategy on_completed{};
     constexpr static forwarding_set_upstream_strategy set_upstream{};
     constexpr static forwarding_is_disposed_strategy is_disposed{};
+
+    constexpr static bool is_fusable = true;
 };
 
 
@@ -60,6 +107,9 @@ public:
     {
         return filter_observable<TObservable, Fn>{std::forward<TObservable>(observable), std::move(m_fn)};
     }
+
+    filter_observer_strategy<Fn> as_stage() const & { return filter_observer_strategy<Fn>{m_fn}; }
+    filter_observer_strategy<Fn> as_stage() &&      { return filter_observer_strategy<Fn>{std::move(m_fn)}; }
 };
 }
 
@@ -0,0 +1,386 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+#include <rpp/defs.hpp>
+#include <rpp/disposables/base_disposable.hpp>
+#include <rpp/disposables/disposable_wrapper.hpp>
+#include <rpp/observables/base_observable.hpp>
+#include <rpp/observers/base_observer.hpp>
+#include <rpp/operators/details/inner_subscription_slot.hpp>
+#include <rpp/operators/details/serialized_emitter.hpp>
+#include <rpp/operators/details/strategy.hpp>
+#include <rpp/operators/details/weak_disposable.hpp>
+#include <rpp/sources/concat.hpp>
+#include <rpp/utils/mpsc_queue.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rpp::operators::details
+{
+/**
+ * @brief Shared state of flat_map: serializes emissions of inner observables to original observer, limits amount of concurrently active inner observables
+ * and recycles slots of completed ones.
+ * @details Inner observables are subscribed by one "subscriber" at a time (thread which moves `m_subscribe_wip` from 0). Observables which can't be
+ * subscribed right now wait in queue till some inner observable completes and returns its slot.
+ *
+ * Same as in rpp::source::concat, subscriber links rpp::details::concat_drain_frame to stack of current thread during subscribe: inner observable
+ * completed synchronously inside of it just passes slot back to subscriber without any atomics and subscriber goes on with the next one without recursion.
+ */
+template<rpp::constraint::decayed_type Type, rpp::constraint::observable InnerObservable, rpp::constraint::observer TObserver>
+class flat_map_disposable final : public rpp::base_disposable
+{
+    struct subscribe_frame final : rpp::details::concat_drain_frame
+    {
+        inner_subscription_slot* completed_slot{};
+    };
+
+public:
+    using value_type = Type;
+
+    flat_map_disposable(TObserver&& observer, size_t max_concurrency)
+        : m_emitter{std::move(observer)}
+        , m_max_concurrency{std::max<size_t>(max_concurrency, 1)} {}
+
+    static std::shared_ptr<flat_map_disposable> create(TObserver&& observer, size_t max_concurrency)
+    {
+        auto state = std::make_shared<flat_map_disposable>(std::move(observer), max_concurrency);
+        state->m_emitter.get_observer().set_upstream(weak_disposable::make(state));
+        return state;
+    }
+
+    void on_next_observable(const std::shared_ptr<flat_map_disposable>& self, InnerObservable&& observable)
+    {
+        m_active_sources.fetch_add(1, std::memory_order_relaxed);
+
+        // without limit nobody waits for slot, so inner observables are subscribed only here and emissions of source are serialized anyway
+        if (m_max_concurrency == std::numeric_limits<size_t>::max())
+        {
+            if (!is_disposed())
+                subscribe_inner(self, std::move(observable), *acquire_slot());
+            return;
+        }
+
+        size_t expected{};
+        if (m_subscribe_wip.load(std::memory_order_relaxed) == 0 && m_subscribe_wip.compare_exchange_strong(expected, 1, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            // nobody waits for slot -> nothing to keep order with
+            if (m_waiting_count.load(std::memory_order_relaxed) == 0)
+            {
+                if (auto* slot = acquire_slot())
+                {
+                    subscribe_inner(self, std::move(observable), *slot);
+
+                    if (const auto missed = m_subscribe_wip.fetch_sub(1, std::memory_order_acq_rel) - 1; missed != 0)
+                        drain(self, missed);
+                    return;
+                }
+            }
+
+            enqueue(std::move(observable));
+            drain(self, 1);
+            return;
+        }
+
+        enqueue(std::move(observable));
+        request_drain(self);
+    }
+
+    template<typename T>
+    void on_next(T&& v)
+    {
+        m_emitter.on_next(std::forward<T>(v));
+    }
+
+    void on_error(const std::exception_ptr& err)
+    {
+        m_emitter.on_error(err);
+        dispose();
+    }
+
+    void on_inner_completed(const std::shared_ptr<flat_map_disposable>& self, inner_subscription_slot& slot, const rpp::details::concat_drain_frame::key& frame_key)
+    {
+        slot.reset();
+
+        if (auto* frame = rpp::details::concat_drain_frame::find_active(frame_key))
+        {
+            static_cast<subscribe_frame&>(*frame).completed_slot = &slot;
+        }
+        else
+        {
+            release_slot(slot);
+            // pairs with enqueue: either subscriber sees released slot or we see waiting observable
+            if (m_waiting_count.load(std::memory_order_seq_cst) != 0)
+                request_drain(self);
+        }
+
+        on_source_completed();
+    }
+
+    void on_source_completed()
+    {
+        if (m_active_sources.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            m_emitter.on_completed();
+    }
+
+private:
+    void enqueue(InnerObservable&& observable)
+    {
+        m_waiting_count.fetch_add(1, std::memory_order_seq_cst);
+        m_pending.emplace(std::move(observable));
+    }
+
+    void request_drain(const std::shared_ptr<flat_map_disposable>& self)
+    {
+        if (m_subscribe_wip.fetch_add(1, std::memory_order_acq_rel) == 0)
+            drain(self, 1);
+    }
+
+    void drain(const std::shared_ptr<flat_map_disposable>& self, size_t missed)
+    {
+        while (true)
+        {
+            while (!is_disposed() && m_waiting_count.load(std::memory_order_seq_cst) != 0)
+            {
+                auto* slot = acquire_slot();
+                if (!slot)
+                    break;
+
+                const bool popped = m_pending.pop_to([&](InnerObservable&& observable) {
+                    m_waiting_count.fetch_sub(1, std::memory_order_relaxed);
+                    subscribe_inner(self, std::move(observable), *slot);
+                });
+
+                if (!popped)
+                {
+                    // producer is still linking its node: keep slot for the next attempt, producer requests drain anyway
+                    m_completed_slot = slot;
+                    break;
+                }
+            }
+
+            missed = m_subscribe_wip.fetch_sub(missed, std::memory_order_acq_rel) - missed;
+            if (missed == 0)
+                return;
+        }
+    }
+
+    void subscribe_inner(const std::shared_ptr<flat_map_disposable>& self, InnerObservable&& observable, inner_subscription_slot& slot);
+
+    inner_subscription_slot* acquire_slot()
+    {
+        if (auto* slot = std::exchange(m_completed_slot, nullptr))
+            return slot;
+
+        // only subscriber takes slots, so stack of free slots has one consumer and can't suffer from ABA
+        auto* head = m_free_slots.load(std::memory_order_seq_cst);
+        while (head && !m_free_slots.compare_exchange_weak(head, head->next_free, std::memory_order_seq_cst)) {}
+        if (head)
+            return head;
+
+        if (m_slots.size() == m_max_concurrency)
+            return nullptr;
+
+        auto& slot = m_slots.emplace_back(std::make_shared<inner_subscription_slot>());
+        add(slot);
+        // state is disposed already -> slot would not be disposed by it
+        if (is_disposed())
+            slot->dispose();
+        return slot.get();
+    }
+
+    void release_slot(inner_subscription_slot& slot)
+    {
+        auto* head = m_free_slots.load(std::memory_order_relaxed);
+        do
+        {
+            slot.next_free = head;
+        } while (!m_free_slots.compare_exchange_weak(head, &slot, std::memory_order_seq_cst, std::memory_order_relaxed));
+    }
+
+private:
+    serialized_emitter<Type, TObserver> m_emitter;
+    const size_t                        m_max_concurrency;
+    // outer source is active from the beginning
+    std::atomic<size_t>                 m_active_sources{1};
+
+    std::atomic<size_t>                       m_subscribe_wip{};
+    std::atomic<size_t>                       m_waiting_count{};
+    rpp::details::mpsc_queue<InnerObservable> m_pending{};
+    std::atomic<inner_subscription_slot*>     m_free_slots{};
+
+    // owned by subscriber only
+    inner_subscription_slot*                              m_completed_slot{};
+    std::vector<std::shared_ptr<inner_subscription_slot>> m_slots{};
+};
+
+/**
+ * @brief Observer passing values of inner observables to shared state. One such lightweight observer (just pointer to state) is created per inner observable.
+ * @details State is kept alive by rpp::operators::details::flat_map_inner_observer_strategy living next to this observer.
+ */
+template<typename State>
+struct flat_map_forwarding_observer_strategy
+{
+    using Type = typename State::value_type;
+
+    State* state;
+
+    void on_next(const Type& v) const { state->on_next(v); }
+    void on_next(Type&& v) const { state->on_next(std::move(v)); }
+    void on_error(const std::exception_ptr& err) const { state->on_error(err); }
+    void on_completed() const {}
+
+    void set_upstream(const disposable_wrapper&) const {}
+    bool is_disposed() const { return state->is_disposed(); }
+};
+
+/**
+ * @brief Strategy of inner observer: built on top of rpp::operators::details::operator_strategy_base the same way as concat_source_observer_strategy,
+ * but instead of moving original observer from one inner observable to another it only returns slot on completion.
+ */
+template<typename State>
+struct flat_map_inner_observer_strategy
+{
+    std::shared_ptr<State>                state;
+    inner_subscription_slot*                  slot;
+    rpp::details::concat_drain_frame::key frame_key;
+
+    constexpr static forwarding_on_next_strategy on_next{};
+    constexpr static forwarding_on_error_strategy on_error{};
+    constexpr static forwarding_is_disposed_strategy is_disposed{};
+
+    void set_upstream(const rpp::constraint::observer auto&, const disposable_wrapper& d) const { slot->set_upstream(d); }
+    void on_completed(const rpp::constraint::observer auto&) const { state->on_inner_completed(state, *slot, frame_key); }
+};
+
+template<rpp::constraint::decayed_type Type, rpp::constraint::observable InnerObservable, rpp::constraint::observer TObserver>
+void flat_map_disposable<Type, InnerObservable, TObserver>::subscribe_inner(const std::shared_ptr<flat_map_disposable>& self, InnerObservable&& observable, inner_subscription_slot& slot)
+{
+    using forwarding_observer = base_observer<Type, flat_map_forwarding_observer_strategy<flat_map_disposable>>;
+
+    subscribe_frame frame{};
+    std::move(observable).subscribe(base_observer<Type, operator_strategy_base<Type, forwarding_observer, flat_map_inner_observer_strategy<flat_map_disposable>>>{
+        forwarding_observer{this},
+        self,
+        &slot,
+        frame.get_key()});
+
+    // nobody else could take slot completed synchronously, so keep it for the next inner observable
+    m_completed_slot = frame.completed_slot;
+}
+
+template<typename State, rpp::constraint::decayed_type Fn>
+struct flat_map_observer_strategy
+{
+    std::shared_ptr<State> state;
+    RPP_NO_UNIQUE_ADDRESS Fn fn;
+
+    template<typename T>
+    void on_next(T&& v) const
+    {
+        state->on_next_observable(state, fn(std::forward<T>(v)));
+    }
+
+    void on_error(const std::exception_ptr& err) const { state->on_error(err); }
+    void on_completed() const { state->on_source_completed(); }
+
+    void set_upstream(const disposable_wrapper& d) const { state->add(d.get_original()); }
+    bool is_disposed() const { return state->is_disposed(); }
+};
+
+template<rpp::constraint::observable TObservable, rpp::constraint::decayed_type Fn>
+struct flat_map_observable_strategy
+{
+    using SourceType      = rpp::utils::extract_observable_type_t<TObservable>;
+    using InnerObservable = std::decay_t<std::invoke_result_t<Fn, SourceType>>;
+    using Type            = rpp::utils::extract_observable_type_t<InnerObservable>;
+
+    RPP_NO_UNIQUE_ADDRESS TObservable observable;
+    RPP_NO_UNIQUE_ADDRESS Fn          fn;
+    size_t                            max_concurrency;
+
+    template<rpp::constraint::observer_strategy<Type> Strategy>
+    void subscribe(base_observer<Type, Strategy>&& observer) const
+    {
+        using state_t = flat_map_disposable<Type, InnerObservable, base_observer<Type, Strategy>>;
+
+        observable.subscribe(base_observer<SourceType, flat_map_observer_strategy<state_t, Fn>>{state_t::create(std::move(observer), max_concurrency), fn});
+    }
+};
+
+template<rpp::constraint::decayed_type Fn>
+struct flat_map_t
+{
+    RPP_NO_UNIQUE_ADDRESS Fn fn;
+    size_t                   max_concurrency;
+
+    template<rpp::constraint::observable TObservable>
+        requires (std::invocable<Fn, rpp::utils::extract_observable_type_t<TObservable>> && rpp::constraint::observable<std::invoke_result_t<Fn, rpp::utils::extract_observable_type_t<TObservable>>>)
+    auto operator()(TObservable&& observable) const
+    {
+        using strategy = flat_map_observable_strategy<std::decay_t<TObservable>, Fn>;
+        return rpp::base_observable<typename strategy::Type, strategy>{std::forward<TObservable>(observable), fn, max_concurrency};
+    }
+};
+}
+
+namespace rpp::operators
+{
+/**
+ * @brief Transforms each item emitted by observable into observable via provided callable and merges emissions of all such observables into one observable.
+ *
+ * @marble flat_map
+     {
+         source observable                     : +--1--2--3--|
+         operator "flat_map: x=>just(x,x+10)" : +--(1,11)-(2,12)-(3,13)-|
+     }
+ *
+ * @details Actually it is `map(callable) | merge()`, but with limit for amount of concurrently active inner observables. When limit is reached, new inner
+ * observables are kept in queue and subscribed one by one as soon as any active inner observable completes. Resulting observable completes when source
+ * observable and all inner observables are completed. Any error is passed immediately and disposes everything.
+ *
+ * @par Performance notes:
+ * - Emissions of inner observables are serialized without locks the same way as in `merge`
+ * - No state or disposable is allocated per inner observable: disposables of inner observables are kept in slots which are allocated once
+ *   (up to amount of concurrently active inner observables) and reused after completion of inner observable.
+ * - Without limit inner observables are subscribed directly by thread of source observable. With limit subscription is serialized via one atomic counter,
+ *   inner observables are queued (with allocation) only when limit is reached.
+ * - Inner observable completed synchronously returns its slot without atomics and doesn't cause recursive subscription of the next one
+ *
+ * @param callable is callable used to transform each item into observable. Should accept `Type` of original observable and return observable
+ * @param max_concurrency is maximum amount of inner observables subscribed at the same time. 0 is treated as 1, default is unlimited
+ * @warning #include <rpp/operators/flat_map.hpp>
+ *
+ * @par Example:
+ * @snippet flat_map.cpp flat_map
+ *
+ * @par Example with limited concurrency:
+ * @snippet flat_map.cpp flat_map with max_concurrency
+ *
+ * @ingroup transforming_operators
+ * @see https://reactivex.io/documentation/operators/flatmap.html
+ */
+template<typename Fn>
+    requires (!utils::is_not_template_callable<Fn> || rpp::constraint::observable<std::invoke_result_t<Fn, utils::convertible_to_any>>)
+auto flat_map(Fn&& callable, size_t max_concurrency /* = std::numeric_limits<size_t>::max() */)
+{
+    return details::flat_map_t<std::decay_t<Fn>>{std::forward<Fn>(callable), max_concurrency};
+}
+} // namespace rpp::operators
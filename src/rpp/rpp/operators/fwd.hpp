@@ -10,10 +10,14 @@
 
 #pragma once
 
+#include <rpp/observables/fwd.hpp>
+#include <rpp/schedulers/fwd.hpp>
 #include <rpp/utils/function_traits.hpp>
 #include <rpp/utils/constraints.hpp>
 #include <rpp/utils/utils.hpp>
 
+#include <limits>
+
 namespace rpp::operators
 {
 auto take(size_t count);
@@ -22,6 +26,14 @@ template<typename Fn>
     requires (!utils::is_not_template_callable<Fn> || !std::same_as<void, std::invoke_result_t<Fn, utils::convertible_to_any>>)
 auto map(Fn&& callable);
 
+template<typename Fn>
+    requires (!utils::is_not_template_callable<Fn> || rpp::constraint::observable<std::invoke_result_t<Fn, utils::convertible_to_any>>)
+auto concat_map(Fn&& callable);
+
+template<typename Fn>
+    requires (!utils::is_not_template_callable<Fn> || rpp::constraint::observable<std::invoke_result_t<Fn, utils::convertible_to_any>>)
+auto flat_map(Fn&& callable, size_t max_concurrency = std::numeric_limits<size_t>::max());
+
 template<typename Fn>
     requires (!utils::is_not_template_callable<Fn> || std::same_as<bool, std::invoke_result_t<Fn, utils::convertible_to_any>>)
 auto filter(Fn&& predicate);
@@ -32,4 +44,16 @@ auto take_while(Fn&& predicate);
 
 auto repeat(size_t count);
 auto repeat();
+
+template<rpp::schedulers::constraint::scheduler Scheduler>
+auto observe_on(Scheduler&& scheduler);
+
+template<rpp::schedulers::constraint::scheduler Scheduler>
+auto subscribe_on(Scheduler&& scheduler);
+
+auto merge();
+
+template<rpp::constraint::observable TObservable, rpp::constraint::observable... TObservables>
+    requires (std::same_as<rpp::utils::extract_observable_type_t<TObservable>, rpp::utils::extract_observable_type_t<TObservables>> && ...)
+auto merge_with(TObservable&& observable, TObservables&&... observables);
 }
\ No newline at end of file
@@ -13,7 +13,12 @@
 #include <rpp/operators/fwd.hpp>
 #include <rpp/defs.hpp>
 #include <rpp/operators/details/strategy.hpp>
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <exception>
+#include <span>
+#include <type_traits>
 
 namespace rpp::operators::details
 {
@@ -22,16 +27,56 @@ struct map_observer_strategy
 {
     RPP_NO_UNIQUE_ADDRESS Fn fn;
 
+    template<typename T, typename TObs>
+    static constexpr bool is_nothrow_on_next = requires(const Fn& fn, T&& v, const TObs& obs) { { obs.on_next(fn(std::forward<T>(v))) } noexcept; };
+
     template<typename T>
-    void on_next(const rpp::constraint::observer auto& obs, T&& v) const
+    void on_next(const auto& obs, T&& v) const
     {
         obs.on_next(fn(std::forward<T>(v)));
     }
 
+    template<typename T, typename TObs>
+    void on_next_batch(const TObs& obs, std::span<const T> values) const
+    {
+        using result_type = std::decay_t<std::invoke_result_t<const Fn&, const T&>>;
+        if constexpr (batch_bufferable<result_type> && batch_native_observer<TObs>)
+        {
+            std::array<result_type, batch_chunk_size> results;
+            for (size_t offset = 0; offset < values.size() && !obs.is_disposed();)
+            {
+                const auto chunk = values.subspan(offset, std::min({results.size(), values.size() - offset, get_batch_demand(obs)}));
+
+                size_t computed{};
+                RPP_TRY
+                {
+                    for (; computed < chunk.size(); ++computed)
+                        results[computed] = fn(chunk[computed]);
+                }
+                RPP_CATCH(...)
+                {
+                    // values before failed one would be emitted in case of emitting one by one
+                    if (computed != 0)
+                        obs.on_next_batch(std::span<const result_type>{results.data(), computed});
+                    std::rethrow_exception(std::current_exception());
+                }
+
+                obs.on_next_batch(std::span<const result_type>{results.data(), chunk.size()});
+                offset += chunk.size();
+            }
+        }
+        else
+        {
+            on_next_each(*this, obs, values);
+        }
+    }
+
     constexpr static forwarding_on_error_strategy on_error{};
     constexpr static forwarding_on_completed_strategy on_completed{};
     constexpr static forwarding_set_upstream_strategy set_upstream{};
     constexpr static forwarding_is_disposed_strategy is_disposed{};
+
+    constexpr static bool is_fusable = true;
 };
 
 template<rpp::constraint::observable TObservable, std::invocable<rpp::utils::extract_observable_type_t<TObservable>> Fn>
@@ -59,6 +104,9 @@ struct map_t
     {
         return map_observable<TObservable, Fn>{std::forward<TObservable>(observable), std::move(m_fn)};
     }
+
+    map_observer_strategy<Fn> as_stage() const & { return map_observer_strategy<Fn>{m_fn}; }
+    map_observer_strategy<Fn> as_stage() &&      { return map_observer_strategy<Fn>{std::move(m_fn)}; }
 };
 }
 
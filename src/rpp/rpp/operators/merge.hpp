@@ -0,0 +1,242 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+#include <rpp/defs.hpp>
+#include <rpp/disposables/base_disposable.hpp>
+#include <rpp/disposables/disposable_wrapper.hpp>
+#include <rpp/observables/base_observable.hpp>
+#include <rpp/observers/base_observer.hpp>
+#include <rpp/operators/details/serialized_emitter.hpp>
+#include <rpp/operators/details/weak_disposable.hpp>
+#include <rpp/schedulers/immediate.hpp>
+#include <rpp/sources/concat.hpp>
+#include <rpp/sources/from.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace rpp::operators::details
+{
+/**
+ * @brief Shared state of merge: serializes emissions of all sources to original observer and tracks amount of active sources.
+ * @details Original observer is completed when all sources (including outer one) are completed. First error is passed immediately.
+ * State is disposable of the whole subscription: disposing of it disposes all sources.
+ */
+template<rpp::constraint::decayed_type Type, rpp::constraint::observer TObserver>
+class merge_disposable final : public rpp::base_disposable
+{
+public:
+    using value_type = Type;
+
+    explicit merge_disposable(TObserver&& observer)
+        : m_emitter{std::move(observer)} {}
+
+    static std::shared_ptr<merge_disposable> create(TObserver&& observer)
+    {
+        auto state = std::make_shared<merge_disposable>(std::move(observer));
+        state->m_emitter.get_observer().set_upstream(weak_disposable::make(state));
+        return state;
+    }
+
+    void add_source() { m_active_sources.fetch_add(1, std::memory_order_relaxed); }
+
+    template<typename T>
+    void on_next(T&& v)
+    {
+        m_emitter.on_next(std::forward<T>(v));
+    }
+
+    void on_error(const std::exception_ptr& err)
+    {
+        m_emitter.on_error(err);
+        dispose();
+    }
+
+    void on_source_completed()
+    {
+        if (m_active_sources.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            m_emitter.on_completed();
+    }
+
+private:
+    serialized_emitter<Type, TObserver> m_emitter;
+    // outer source is active from the beginning
+    std::atomic<size_t> m_active_sources{1};
+};
+
+/**
+ * @brief Observer of inner observable. Keeps handle of disposable of inner observable to remove it from state on completion: long-lived merge
+ * over many short inner observables doesn't grow list of children of state.
+ */
+template<typename State>
+struct merge_inner_observer_strategy
+{
+    using Type = typename State::value_type;
+
+    std::shared_ptr<State>               state;
+    mutable rpp::base_disposable::handle upstream_handle{};
+
+    void on_next(const Type& v) const { state->on_next(v); }
+    void on_next(Type&& v) const { state->on_next(std::move(v)); }
+    void on_error(const std::exception_ptr& err) const { state->on_error(err); }
+
+    void on_completed() const
+    {
+        upstream_handle.remove();
+        state->on_source_completed();
+    }
+
+    void set_upstream(const disposable_wrapper& d) const
+    {
+        upstream_handle.remove();
+        upstream_handle = state->add_with_handle(d.get_original());
+    }
+    bool is_disposed() const { return state->is_disposed(); }
+};
+
+template<typename State>
+struct merge_observer_strategy
+{
+    using Type = typename State::value_type;
+
+    std::shared_ptr<State> state;
+
+    template<rpp::constraint::observable TObservable>
+    void on_next(TObservable&& observable) const
+    {
+        state->add_source();
+        std::forward<TObservable>(observable).subscribe(base_observer<Type, merge_inner_observer_strategy<State>>{state});
+    }
+
+    void on_error(const std::exception_ptr& err) const { state->on_error(err); }
+    void on_completed() const { state->on_source_completed(); }
+
+    void set_upstream(const disposable_wrapper& d) const { state->add(d.get_original()); }
+    bool is_disposed() const { return state->is_disposed(); }
+};
+
+template<rpp::constraint::observable TObservable>
+struct merge_observable_strategy
+{
+    using Type = rpp::utils::extract_observable_type_t<rpp::utils::extract_observable_type_t<TObservable>>;
+
+    RPP_NO_UNIQUE_ADDRESS TObservable observable;
+
+    template<rpp::constraint::observer_strategy<Type> Strategy>
+    void subscribe(base_observer<Type, Strategy>&& observer) const
+    {
+        using state_t = merge_disposable<Type, base_observer<Type, Strategy>>;
+
+        observable.subscribe(base_observer<rpp::utils::extract_observable_type_t<TObservable>, merge_observer_strategy<state_t>>{state_t::create(std::move(observer))});
+    }
+};
+
+struct merge_t
+{
+    template<rpp::constraint::observable TObservable>
+        requires rpp::constraint::observable<rpp::utils::extract_observable_type_t<TObservable>>
+    auto operator()(TObservable&& observable) const
+    {
+        using Type = rpp::utils::extract_observable_type_t<rpp::utils::extract_observable_type_t<TObservable>>;
+        return rpp::base_observable<Type, merge_observable_strategy<std::decay_t<TObservable>>>{std::forward<TObservable>(observable)};
+    }
+};
+
+template<rpp::constraint::observable... TObservables>
+struct merge_with_t
+{
+    RPP_NO_UNIQUE_ADDRESS std::tuple<TObservables...> observables;
+
+    template<rpp::constraint::observable TObservable>
+        requires (std::same_as<rpp::utils::extract_observable_type_t<TObservable>, rpp::utils::extract_observable_type_t<TObservables>> && ...)
+    auto operator()(TObservable&& observable) const
+    {
+        return std::apply([&observable](const TObservables&... others)
+                          {
+                              return merge_t{}(rpp::details::make_from_iterable_observable(rpp::details::pack_observables<rpp::memory_model::use_stack>(std::forward<TObservable>(observable), others...),
+                                                                                           rpp::schedulers::immediate{}));
+                          },
+                          observables);
+    }
+};
+}
+
+namespace rpp::operators
+{
+/**
+ * @brief Converts observable of observables into observable of values which emits values from all underlying observables as soon as they are emitted.
+ *
+ * @marble merge
+     {
+         source observable :
+         {
+             +--1-2-3-|
+             .....+4--6-|
+         }
+         operator "merge" : +--1-243-6-|
+     }
+ *
+ * @details Actually it subscribes on each observable emitted by source observable. Resulting observable completes when source observable and all
+ * underlying observables are completed. Any error is passed immediately and disposes everything.
+ *
+ * @par Performance notes:
+ * - Emissions from different threads are serialized without locks: thread which finds nobody emitting emits its value in place,
+ *   other threads only enqueue values to lock-free queue drained by emitting thread. So producers never block each other.
+ * - Without contention values are passed downstream directly without any queueing or allocation.
+ *
+ * @warning #include <rpp/operators/merge.hpp>
+ *
+ * @par Example:
+ * @snippet merge.cpp merge
+ *
+ * @ingroup combining_operators
+ * @see https://reactivex.io/documentation/operators/merge.html
+ */
+inline auto merge()
+{
+    return details::merge_t{};
+}
+
+/**
+ * @brief Combines submissions from current observable with other observables into one
+ *
+ * @marble merge_with
+     {
+         source original_observable: +--1-2-3-|
+         source second: +-----4--6-|
+         operator "merge_with" : +--1-243-6-|
+     }
+ *
+ * @details Actually it is `merge` applied to observable emitting current observable and provided observables.
+ *
+ * @param observables are observables whose emissions would be merged with current observable
+ * @warning #include <rpp/operators/merge.hpp>
+ *
+ * @par Example:
+ * @snippet merge.cpp merge_with
+ *
+ * @ingroup combining_operators
+ * @see https://reactivex.io/documentation/operators/merge.html
+ */
+template<rpp::constraint::observable TObservable, rpp::constraint::observable... TObservables>
+    requires (std::same_as<rpp::utils::extract_observable_type_t<TObservable>, rpp::utils::extract_observable_type_t<TObservables>> && ...)
+auto merge_with(TObservable&& observable, TObservables&&... observables)
+{
+    return details::merge_with_t<std::decay_t<TObservable>, std::decay_t<TObservables>...>{std::tuple{std::forward<TObservable>(observable), std::forward<TObservables>(observables)...}};
+}
+} // namespace rpp::operators
@@ -0,0 +1,274 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+#include <rpp/defs.hpp>
+#include <rpp/disposables/base_disposable.hpp>
+#include <rpp/disposables/disposable_wrapper.hpp>
+#include <rpp/observables/base_observable.hpp>
+#include <rpp/observers/base_observer.hpp>
+#include <rpp/operators/details/spsc_queue.hpp>
+#include <rpp/operators/details/strategy.hpp>
+#include <rpp/operators/details/weak_disposable.hpp>
+#include <rpp/schedulers/fwd.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <span>
+#include <utility>
+
+namespace rpp::operators::details
+{
+/**
+ * @brief Approximate amount of memory of one segment of queue used by observe_on.
+ */
+inline constexpr size_t observe_on_segment_bytes = 4096;
+
+/**
+ * @brief Amount of values in one segment of queue used by observe_on to pass values of type `T` between threads.
+ * @details Segments are allocated only when needed, so amount of values is derived from size of slot to keep memory of segment bounded by
+ * rpp::operators::details::observe_on_segment_bytes: 1024 values for `int`, less for bigger types, but never less than 16 values.
+ */
+template<typename T>
+inline constexpr size_t observe_on_segment_capacity = std::clamp<size_t>(std::bit_floor(observe_on_segment_bytes / sizeof(typename spsc_queue<T>::slot_type)), 16, 1024);
+
+/**
+ * @brief Maximal amount of values emitted by one execution of drain schedulable before giving other schedulables of scheduler a chance to run.
+ */
+inline constexpr size_t observe_on_drain_limit = 1024;
+
+/**
+ * @brief Shared state of observe_on: owns original observer and hands values from upstream thread to scheduler via rpp::operators::details::spsc_queue.
+ * @details Only one drain schedulable exists at a time: upstream increments `wip` per signal and schedules drain only on transition from 0. Drain emits
+ * values visible at the moment (but no more than rpp::operators::details::observe_on_drain_limit) and either finishes (no new signals) or re-schedules
+ * itself to let other schedulables of the scheduler run.
+ *
+ * Queue is unbounded: observe_on has no backpressure, so upstream is never blocked (it would deadlock schedulers running on the same thread) and
+ * memory grows as long as upstream outpaces scheduler.
+ *
+ * State is disposable of the whole subscription: it disposes upstream and worker when original observer disposes it.
+ */
+template<rpp::constraint::decayed_type Type, rpp::constraint::observer TObserver, rpp::schedulers::constraint::worker TWorker>
+class observe_on_state final : public rpp::base_disposable
+    , public std::enable_shared_from_this<observe_on_state<Type, TObserver, TWorker>>
+{
+    using queue = spsc_queue<Type, observe_on_segment_capacity<Type>>;
+
+    struct drain_observer_strategy
+    {
+        std::shared_ptr<observe_on_state> state;
+
+        static void on_next(const Type&) {}
+        static void on_next(Type&&) {}
+        static void on_error(const std::exception_ptr&) {}
+        static void on_completed() {}
+
+        static void set_upstream(const disposable_wrapper&) {}
+        bool        is_disposed() const { return state->is_disposed(); }
+    };
+
+public:
+    using value_type = Type;
+
+    observe_on_state(TObserver&& observer, TWorker&& worker)
+        : m_observer{std::move(observer)}
+        , m_worker{std::move(worker)} {}
+
+    static std::shared_ptr<observe_on_state> create(TObserver&& observer, TWorker&& worker)
+    {
+        auto state = std::make_shared<observe_on_state>(std::move(observer), std::move(worker));
+        state->add(state->m_worker.get_disposable().get_original());
+        state->m_observer.set_upstream(weak_disposable::make(state));
+        return state;
+    }
+
+    template<typename T>
+    void on_next(T&& v)
+    {
+        m_queue.push(std::forward<T>(v));
+        schedule_drain();
+    }
+
+    void on_next_batch(std::span<const Type> values)
+    {
+        for (const auto& v : values)
+            m_queue.push(v);
+        schedule_drain();
+    }
+
+    void on_terminal(const std::exception_ptr& err)
+    {
+        m_error = err;
+        m_done.store(true, std::memory_order_release);
+        schedule_drain();
+    }
+
+private:
+    void schedule_drain()
+    {
+        if (m_wip.fetch_add(1, std::memory_order_acq_rel) != 0)
+            return;
+
+        // drain observer keeps state alive, so raw pointer is valid while schedulable exists
+        m_worker.schedule([](const auto&, observe_on_state* state) { return state->drain(); },
+                          rpp::base_observer<Type, drain_observer_strategy>{this->shared_from_this()},
+                          this);
+    }
+
+    rpp::schedulers::optional_duration drain()
+    {
+        const auto missed = m_wip.load(std::memory_order_acquire);
+        // everything pushed before terminal event is visible after this point
+        const bool done = m_done.load(std::memory_order_acquire);
+
+        const auto emitted = m_queue.consume(observe_on_drain_limit, [this](std::span<typename queue::slot_type> chunk) {
+            if constexpr (queue::stores_values_in_place && batch_native_observer<TObserver>)
+            {
+                m_observer.on_next_batch(std::span<const Type>{chunk});
+            }
+            else
+            {
+                for (auto& slot : chunk)
+                {
+                    if (m_observer.is_disposed())
+                        return false;
+
+                    if constexpr (queue::stores_values_in_place)
+                        m_observer.on_next(std::move(slot));
+                    else
+                        m_observer.on_next(std::move(*slot));
+                }
+            }
+            return !m_observer.is_disposed();
+        });
+
+        if (m_observer.is_disposed())
+            return std::nullopt;
+
+        // values counted by `missed` could be still queued: keep `wip` as is to be the only drain and continue later
+        if (emitted == observe_on_drain_limit)
+            return rpp::schedulers::duration{};
+
+        if (done)
+        {
+            if (m_error)
+                m_observer.on_error(m_error);
+            else
+                m_observer.on_completed();
+            return std::nullopt;
+        }
+
+        if (m_wip.fetch_sub(missed, std::memory_order_acq_rel) == missed)
+            return std::nullopt;
+
+        // new values arrived during draining: re-schedule this schedulable instead of spinning inside of scheduler
+        return rpp::schedulers::duration{};
+    }
+
+private:
+    RPP_NO_UNIQUE_ADDRESS TObserver m_observer;
+    RPP_NO_UNIQUE_ADDRESS TWorker   m_worker;
+
+    queue               m_queue{};
+    std::atomic<size_t> m_wip{};
+    std::atomic<bool>   m_done{};
+    std::exception_ptr  m_error{};
+};
+
+template<typename State>
+struct observe_on_observer_strategy
+{
+    using Type = typename State::value_type;
+
+    std::shared_ptr<State> state;
+
+    void on_next(const Type& v) const { state->on_next(v); }
+    void on_next(Type&& v) const { state->on_next(std::move(v)); }
+    void on_next_batch(std::span<const Type> values) const { state->on_next_batch(values); }
+    void on_error(const std::exception_ptr& err) const { state->on_terminal(err); }
+    void on_completed() const { state->on_terminal({}); }
+
+    void set_upstream(const disposable_wrapper& d) const { state->add(d.get_original()); }
+    bool is_disposed() const { return state->is_disposed(); }
+};
+
+template<rpp::constraint::observable TObservable, rpp::schedulers::constraint::scheduler TScheduler>
+struct observe_on_observable_strategy
+{
+    using Type = rpp::utils::extract_observable_type_t<TObservable>;
+
+    RPP_NO_UNIQUE_ADDRESS TObservable observable;
+    RPP_NO_UNIQUE_ADDRESS TScheduler  scheduler;
+
+    template<rpp::constraint::observer_strategy<Type> Strategy>
+    void subscribe(base_observer<Type, Strategy>&& observer) const
+    {
+        using state_t = observe_on_state<Type, base_observer<Type, Strategy>, decltype(scheduler.create_worker())>;
+
+        observable.subscribe(base_observer<Type, observe_on_observer_strategy<state_t>>{state_t::create(std::move(observer), scheduler.create_worker())});
+    }
+};
+
+template<rpp::schedulers::constraint::scheduler TScheduler>
+struct observe_on_t
+{
+    RPP_NO_UNIQUE_ADDRESS TScheduler scheduler;
+
+    template<rpp::constraint::observable TObservable>
+    auto operator()(TObservable&& observable) const
+    {
+        return rpp::base_observable<rpp::utils::extract_observable_type_t<TObservable>,
+                                    observe_on_observable_strategy<std::decay_t<TObservable>, TScheduler>>{std::forward<TObservable>(observable), scheduler};
+    }
+};
+}
+
+namespace rpp::operators
+{
+/**
+ * @brief Emit emissions of observable starting from this point via provided scheduler.
+ *
+ * @marble observe_on
+     {
+         source observable           : +-1-2-3-#
+         operator "observe_on:  --"  : +---1-2-3-#
+     }
+ *
+ * @details Actually this operator schedules emissions via provided scheduler. Values are handed from thread of original observable to scheduler via
+ * unbounded lock-free single-producer/single-consumer queue and drained by batches inside of one schedulable, instead of scheduling of new schedulable
+ * per each emission. Drain schedulable is scheduled only when there is no active one, so steady stream of values doesn't allocate at all.
+ *
+ * @par Performance notes:
+ * - Values of trivially copyable types are stored in queue in place and passed to batch-aware observers as contiguous chunks.
+ * - Queue consists of segments of about rpp::operators::details::observe_on_segment_bytes allocated only when needed. Segment taken by scheduler
+ *   is reused for the next values, so queue allocates only when upstream is faster than scheduler.
+ * - There is no backpressure: upstream is never blocked, so memory is unbounded if upstream is constantly faster than scheduler.
+ *
+ * @param scheduler is scheduler used for scheduling of emissions
+ * @warning #include <rpp/operators/observe_on.hpp>
+ *
+ * @par Example:
+ * @snippet observe_on.cpp observe_on
+ *
+ * @ingroup utility_operators
+ * @see https://reactivex.io/documentation/operators/observeon.html
+ */
+template<rpp::schedulers::constraint::scheduler Scheduler>
+auto observe_on(Scheduler&& scheduler)
+{
+    return details::observe_on_t<std::decay_t<Scheduler>>{std::forward<Scheduler>(scheduler)};
+}
+} // namespace rpp::operators
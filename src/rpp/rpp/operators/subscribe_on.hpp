@@ -0,0 +1,89 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+#include <rpp/defs.hpp>
+#include <rpp/observables/base_observable.hpp>
+#include <rpp/observers/base_observer.hpp>
+#include <rpp/schedulers/fwd.hpp>
+
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace rpp::operators::details
+{
+template<rpp::constraint::observable TObservable, rpp::schedulers::constraint::scheduler TScheduler>
+struct subscribe_on_observable_strategy
+{
+    using Type = rpp::utils::extract_observable_type_t<TObservable>;
+
+    RPP_NO_UNIQUE_ADDRESS TObservable observable;
+    RPP_NO_UNIQUE_ADDRESS TScheduler  scheduler;
+
+    template<rpp::constraint::observer_strategy<Type> Strategy>
+    void subscribe(base_observer<Type, Strategy>&& observer) const
+    {
+        const auto worker = scheduler.create_worker();
+        // till actual subscription happens, disposing of observer cancels scheduled subscription. Upstream replaces it with own disposable later
+        observer.set_upstream(worker.get_disposable());
+        worker.schedule([observable = observable](base_observer<Type, Strategy>& obs) -> rpp::schedulers::optional_duration
+                        {
+                            observable.subscribe(std::move(obs));
+                            return std::nullopt;
+                        },
+                        std::move(observer));
+    }
+};
+
+template<rpp::schedulers::constraint::scheduler TScheduler>
+struct subscribe_on_t
+{
+    RPP_NO_UNIQUE_ADDRESS TScheduler scheduler;
+
+    template<rpp::constraint::observable TObservable>
+    auto operator()(TObservable&& observable) const
+    {
+        return rpp::base_observable<rpp::utils::extract_observable_type_t<TObservable>,
+                                    subscribe_on_observable_strategy<std::decay_t<TObservable>, TScheduler>>{std::forward<TObservable>(observable), scheduler};
+    }
+};
+}
+
+namespace rpp::operators
+{
+/**
+ * @brief OnSubscribe function for this observable will be scheduled via provided scheduler
+ *
+ * @details Actually this operator just schedules subscription on original observable via worker obtained from provided scheduler. So, expensive work
+ * performed by observable during subscription (opening of files, building of state and etc) doesn't block caller of `subscribe`.
+ * Disposable of worker is passed to observer as upstream, so disposing of observer before actual subscription cancels it.
+ *
+ * @par Performance notes:
+ * - Observable is copied to schedulable, so it is alive even if original observable is destroyed before subscription.
+ * - Emissions of observable are not scheduled at all: they happen in the same way as without this operator. Use rpp::operators::observe_on to move emissions to another scheduler.
+ *
+ * @param scheduler is scheduler used for scheduling of subscription
+ * @warning #include <rpp/operators/subscribe_on.hpp>
+ *
+ * @par Example:
+ * @snippet subscribe_on.cpp subscribe_on
+ *
+ * @ingroup utility_operators
+ * @see https://reactivex.io/documentation/operators/subscribeon.html
+ */
+template<rpp::schedulers::constraint::scheduler Scheduler>
+auto subscribe_on(Scheduler&& scheduler)
+{
+    return details::subscribe_on_t<std::decay_t<Scheduler>>{std::forward<Scheduler>(scheduler)};
+}
+} // namespace rpp::operators
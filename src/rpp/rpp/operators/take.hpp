@@ -13,7 +13,9 @@
 #include <rpp/operators/fwd.hpp>
 #include <rpp/defs.hpp>
 #include <rpp/operators/details/strategy.hpp>
+#include <algorithm>
 #include <cstddef>
+#include <span>
 
 namespace rpp::operators::details
 {
@@ -34,6 +36,24 @@ struct take_observer_strategy
             obs.on_completed();
     }
 
+    template<typename T>
+    void on_next_batch(const rpp::constraint::observer auto& obs, std::span<const T> values) const
+    {
+        if (values.empty())
+            return;
+
+        if (const auto taken = values.first(std::min(count, values.size())); !taken.empty())
+        {
+            count -= taken.size();
+            obs.on_next_batch(taken);
+        }
+
+        if (count == 0)
+            obs.on_completed();
+    }
+
+    size_t batch_demand(const rpp::constraint::observer auto& obs) const { return std::min(count, get_batch_demand(obs)); }
+
     constexpr static forwarding_on_error_strategy on_error{};
     constexpr static forwarding_on_completed_strategy on_completed{};
     constexpr static forwarding_set_upstream_strategy set_upstream{};
@@ -14,6 +14,11 @@
 #include <rpp/defs.hpp>
 #include <rpp/operators/details/strategy.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <span>
+
 namespace rpp::operators::details
 {
 template<rpp::constraint::decayed_type Fn>
@@ -22,7 +27,7 @@ struct take_while_observer_strategy
     RPP_NO_UNIQUE_ADDRESS Fn fn;
 
     template<typename T>
-    void on_next(const rpp::constraint::observer auto& obs, T&& v) const
+    void on_next(const auto& obs, T&& v) const
     {
         if (fn(rpp::utils::as_const(v)))
             obs.on_next(std::forward<T>(v));
@@ -30,10 +35,49 @@ struct take_while_observer_strategy
             obs.on_completed();
     }
 
+    template<typename T>
+    void on_next_batch(const auto& obs, std::span<const T> values) const
+    {
+        for (size_t offset = 0; offset < values.size() && !obs.is_disposed();)
+        {
+            // predicate is not invoked for values after the last one downstream accepts
+            const auto chunk = values.subspan(offset, std::min(values.size() - offset, get_batch_demand(obs)));
+
+            size_t satisfied{};
+            RPP_TRY
+            {
+                while (satisfied < chunk.size() && fn(chunk[satisfied]))
+                    ++satisfied;
+            }
+            RPP_CATCH(...)
+            {
+                // values before failed one would be emitted in case of emitting one by one
+                if (satisfied != 0)
+                    obs.on_next_batch(chunk.first(satisfied));
+                std::rethrow_exception(std::current_exception());
+            }
+
+            if (satisfied != 0)
+                obs.on_next_batch(chunk.first(satisfied));
+
+            if (satisfied != chunk.size())
+            {
+                obs.on_completed();
+                return;
+            }
+            offset += chunk.size();
+        }
+    }
+
+    // any value can be the last one, so values computed ahead by upstream could be never needed
+    size_t batch_demand(const auto&) const { return 1; }
+
     constexpr static forwarding_on_error_strategy on_error{};
     constexpr static forwarding_on_completed_strategy on_completed{};
     constexpr static forwarding_set_upstream_strategy set_upstream{};
     constexpr static forwarding_is_disposed_strategy is_disposed{};
+
+    constexpr static bool is_fusable = true;
 };
 
 
@@ -60,6 +104,9 @@ public:
     {
         return take_while_observable<TObservable, Fn>{std::forward<TObservable>(observable), std::move(m_fn)};
     }
+
+    take_while_observer_strategy<Fn> as_stage() const & { return take_while_observer_strategy<Fn>{m_fn}; }
+    take_while_observer_strategy<Fn> as_stage() &&      { return take_while_observer_strategy<Fn>{std::move(m_fn)}; }
 };
 }
 namespace rpp::operators
@@ -18,4 +18,8 @@
  */
 
 #include <rpp/schedulers/immediate.hpp>
-#include <rpp/schedulers/current_thread.hpp>
\ No newline at end of file
+#include <rpp/schedulers/current_thread.hpp>
+#include <rpp/schedulers/new_thread.hpp>
+#include <rpp/schedulers/run_loop.hpp>
+#include <rpp/schedulers/thread_pool.hpp>
+#include <rpp/schedulers/virtual_time.hpp>
\ No newline at end of file
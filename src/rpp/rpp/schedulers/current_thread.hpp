@@ -14,6 +14,8 @@
 #include <rpp/schedulers/details/utils.hpp>
 #include <rpp/schedulers/details/worker.hpp>
 #include <rpp/schedulers/fwd.hpp>
+
+#include <algorithm>
 #include <thread>
 
 namespace rpp::schedulers
@@ -29,50 +31,70 @@ namespace rpp::schedulers
  */
 class current_thread
 {
-    inline static thread_local std::optional<details::schedulables_queue> s_queue{};
+    // schedulables never leave the caller thread, so they can be allocated from resource of rpp::memory_model::arena_scope
+    using queue_type = details::schedulables_queue<details::d_ary_heap<4>, true>;
+
+    // queue is kept alive between drains to reuse its storage, so ownership is tracked separately
+    inline static thread_local queue_type s_queue{};
+    inline static thread_local bool       s_queue_owned{};
     inline static thread_local time_point s_last_now_time{};
+    // latest time_point of schedulable queued with delay: while it is ahead of cached time, some delayed schedulable could be due already
+    inline static thread_local time_point s_latest_delayed_time{};
+
+    static time_point get_now() { return s_last_now_time = clock_type::now(); }
 
-    static void sleep_until(const time_point timepoint)
+    static time_point get_timepoint_after(const duration duration)
     {
-        if (timepoint <= s_last_now_time)
-            return;
+        if (duration > duration::zero())
+        {
+            const auto timepoint = get_now() + duration;
+            s_latest_delayed_time = std::max(s_latest_delayed_time, timepoint);
+            return timepoint;
+        }
 
-        const auto now = clock_type::now();
-        std::this_thread::sleep_for(timepoint - now);
-        s_last_now_time = std::max(now, timepoint);
+        // schedulable without delay just has to be due after everything queued before it and due already: cached time_point is enough
+        // when no delayed schedulable is behind it, otherwise clock is read to keep FIFO order with delayed schedulables which became due
+        return s_latest_delayed_time > s_last_now_time ? get_now() : s_last_now_time;
     }
 
-    static time_point get_now() { return s_last_now_time = clock_type::now(); }
-
-    static void drain_queue(std::optional<details::schedulables_queue>& queue)
+    static void drain_queue(queue_type& queue)
     {
-        while (!queue->is_empty())
+        while (!queue.is_empty())
         {
-            auto top = queue->pop();
-            if (top->is_disposed())
+            // clock is read once per batch: every schedulable already due at this moment is executed before reading clock again
+            const auto now = get_now();
+            if (const auto timepoint = queue.get_top_timepoint(); timepoint > now)
+            {
+                details::sleep_until(timepoint);
                 continue;
+            }
 
-            sleep_until(top->get_timepoint());
-
-            optional_duration duration{0};
-            // immediate like scheduling
-            do
+            while (!queue.is_empty() && queue.get_top_timepoint() <= now)
             {
-                if (duration.value() > duration::zero() && !top->is_disposed())
-                    std::this_thread::sleep_for(duration.value());
-
+                auto top = queue.pop();
                 if (top->is_disposed())
-                    duration.reset();
-                else
-                    duration = (*top)();
+                    continue;
 
-            } while (queue->is_empty() && duration.has_value());
+                optional_duration duration{0};
+                // immediate like scheduling
+                do
+                {
+                    if (duration.value() > duration::zero() && !top->is_disposed())
+                        details::sleep_for(duration.value());
 
-            if (duration.has_value())
-                queue->emplace(get_now() + duration.value(), std::move(top));
+                    if (top->is_disposed())
+                        duration.reset();
+                    else
+                        duration = (*top)();
+
+                } while (queue.is_empty() && duration.has_value());
+
+                if (duration.has_value())
+                    queue.emplace(get_timepoint_after(duration.value()), std::move(top));
+            }
         }
 
-        queue.reset();
+        s_queue_owned = false;
     }
 
 public:
@@ -83,12 +105,12 @@ public:
         static void defer_for(duration duration, Fn&& fn, TObs&& obs, Args&&... args)
         {
             auto& queue = s_queue;
-            const bool someone_owns_queue = queue.has_value();
+            const bool someone_owns_queue = s_queue_owned;
             if (!someone_owns_queue)
             {
-                queue.emplace();
+                s_queue_owned = true;
 
-                const auto optional_duration = details::immediate_scheduling_while_condition(duration, [&queue](){ return queue->is_empty(); }, fn, obs, args...);
+                const auto optional_duration = details::immediate_scheduling_while_condition(duration, [&queue](){ return queue.is_empty(); }, fn, obs, args...);
                 if (!optional_duration || obs.is_disposed())
                     return drain_queue(queue);
                 duration = optional_duration.value();
@@ -96,7 +118,7 @@ public:
             else if (obs.is_disposed())
                 return;
 
-            queue->emplace(get_now() + duration, std::forward<Fn>(fn), std::forward<TObs>(obs), std::forward<Args>(args)...);
+            queue.emplace(get_timepoint_after(duration), std::forward<Fn>(fn), std::forward<TObs>(obs), std::forward<Args>(args)...);
 
             if (!someone_owns_queue)
                 drain_queue(queue);
@@ -109,5 +131,11 @@ public:
     {
         return rpp::schedulers::worker<worker_strategy>{};
     }
+
+    /**
+     * @brief Sets part of waiting for delayed schedulables performed via spinning instead of sleeping in the caller thread (for both current_thread and immediate schedulers).
+     * @details `std::this_thread::sleep_for` usually oversleeps for tens of microseconds, so it is worth to spin for short (sub-100µs) delays. Zero by default.
+     */
+    static void set_spin_before_sleep_threshold(duration threshold) { details::get_spin_before_sleep_threshold() = threshold; }
 };
 } // namespace rpp::schedulers
\ No newline at end of file
@@ -0,0 +1,62 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2023 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <rpp/schedulers/details/schedulable.hpp>
+#include <rpp/utils/mpsc_queue.hpp>
+
+#include <utility>
+
+namespace rpp::schedulers::details
+{
+/**
+ * @brief Lock-free multi-producer single-consumer queue of schedulables: rpp::details::intrusive_mpsc_queue linking schedulables via their own node.
+ * @details Queue doesn't allocate. Each schedulable carries pointer to `Context` provided by producer.
+ *
+ * @warning `pop` and `is_empty` have to be called by one consumer at a time.
+ */
+template<typename Context>
+class mpsc_queue
+{
+public:
+    mpsc_queue() = default;
+
+    mpsc_queue(const mpsc_queue&) = delete;
+    mpsc_queue(mpsc_queue&&)      = delete;
+
+    ~mpsc_queue() noexcept
+    {
+        while (pop().first) {}
+    }
+
+    void push(schedulable_ptr&& schedulable, Context* context)
+    {
+        auto* node         = schedulable.release();
+        node->mpsc_context = context;
+        m_queue.push(node);
+    }
+
+    std::pair<schedulable_ptr, Context*> pop()
+    {
+        auto* node = m_queue.pop();
+        if (!node)
+            return {};
+        return {schedulable_ptr{node}, static_cast<Context*>(node->mpsc_context)};
+    }
+
+    /**
+     * @brief Checks if there is no any pushed or being pushed schedulable. Sequentially consistent with `push` to let consumer safely decide to sleep.
+     */
+    bool is_empty() const { return m_queue.is_empty(); }
+
+private:
+    rpp::details::intrusive_mpsc_queue<schedulable_base> m_queue{};
+};
+} // namespace rpp::schedulers::details
@@ -12,212 +12,394 @@
 #include <rpp/defs.hpp>
 #include <rpp/utils/constraints.hpp>
 #include <rpp/schedulers/fwd.hpp>
+#include <rpp/schedulers/details/mpsc_queue.hpp>
+#include <rpp/schedulers/details/schedulable.hpp>
+#include <rpp/schedulers/details/timing_wheel.hpp>
 #include <rpp/disposables/base_disposable.hpp>
 #include <rpp/utils/utils.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <condition_variable>
-#include <queue>
 #include <memory>
-#include <tuple>
+#include <mutex>
+#include <optional>
+#include <thread>
 #include <utility>
+#include <vector>
 
 namespace rpp::schedulers::details
 {
-class schedulable_base
+/**
+ * @brief Implicit d-ary min-heap keyed on time_point of schedulable plus sequence number of insertion to keep FIFO order for equal time_points.
+ * @details Keys are copied into nodes to avoid touching schedulable itself during sifting. Higher arity makes heap shallower and
+ * sibling comparisons cache-friendly, so `push` and `pop` are O(log_Arity N)
+ */
+template<size_t Arity>
+    requires (Arity >= 2)
+class d_ary_heap
 {
 public:
-    explicit schedulable_base(const time_point& time_point) : m_time_point{time_point} {}
+    void push(schedulable_ptr&& schedulable)
+    {
+        node new_node{schedulable->get_timepoint(), m_current_id++, std::move(schedulable)};
+
+        size_t index = m_nodes.size();
+        m_nodes.emplace_back();
+        while (index > 0)
+        {
+            const size_t parent = (index - 1) / Arity;
+            if (!(new_node < m_nodes[parent]))
+                break;
+
+            m_nodes[index] = std::move(m_nodes[parent]);
+            index          = parent;
+        }
+        m_nodes[index] = std::move(new_node);
+    }
+
+    schedulable_ptr pop()
+    {
+        auto result = std::move(m_nodes.front().schedulable);
 
-    virtual ~schedulable_base() noexcept = default;
+        node last = std::move(m_nodes.back());
+        m_nodes.pop_back();
 
-    virtual optional_duration operator()()        = 0;
-    virtual bool              is_disposed() const = 0;
+        if (!m_nodes.empty())
+            sift_down(std::move(last));
 
-    time_point get_timepoint() const { return m_time_point; }
-    void       set_timepoint(const time_point& timepoint) { m_time_point = timepoint; }
+        return result;
+    }
+
+    bool is_empty() const { return m_nodes.empty(); }
 
-    const std::shared_ptr<schedulable_base>& get_next() const { return m_next; }
-    void set_next(std::shared_ptr<schedulable_base>&& next) { m_next = std::move(next); }
+    time_point get_top_timepoint() const { return m_nodes.front().timepoint; }
 
-    void update_next(std::shared_ptr<schedulable_base>&& next) 
+private:
+    struct node
     {
-        if (next)
-            next->set_next(std::move(m_next));
-        m_next = std::move(next);
+        time_point      timepoint{};
+        size_t          id{};
+        schedulable_ptr schedulable{};
+
+        bool operator<(const node& other) const
+        {
+            return timepoint < other.timepoint || (timepoint == other.timepoint && id < other.id);
+        }
+    };
+
+    void sift_down(node&& value)
+    {
+        const size_t size  = m_nodes.size();
+        size_t       index = 0;
+        while (true)
+        {
+            const size_t first_child = index * Arity + 1;
+            if (first_child >= size)
+                break;
+
+            const size_t last_child = std::min(first_child + Arity, size);
+            size_t       min_child  = first_child;
+            for (size_t child = first_child + 1; child < last_child; ++child)
+            {
+                if (m_nodes[child] < m_nodes[min_child])
+                    min_child = child;
+            }
+
+            if (!(m_nodes[min_child] < value))
+                break;
+
+            m_nodes[index] = std::move(m_nodes[min_child]);
+            index          = min_child;
+        }
+        m_nodes[index] = std::move(value);
     }
 
 private:
-    std::shared_ptr<schedulable_base> m_next{};
-    time_point                        m_time_point;
+    std::vector<node> m_nodes{};
+    size_t            m_current_id{};
 };
 
-template<rpp::constraint::decayed_type Fn, rpp::constraint::observer TObs, rpp::constraint::decayed_type... Args>
-    requires constraint::schedulable_fn<Fn, TObs, Args...>
-class specific_schedulable final : public schedulable_base
+/**
+ * @brief Queue of schedulables ordered by time_point. Schedulables with same time_point are dispatched in order of emplacing.
+ *
+ * @tparam Backend is storage used to keep order of schedulables. See rpp::schedulers::constraint::schedulables_queue_backend
+ * @tparam ThreadLocal queue is filled and dispatched only by one thread, so schedulables can be allocated from resource of rpp::memory_model::arena_scope
+ */
+template<constraint::schedulables_queue_backend Backend = d_ary_heap<4>, bool ThreadLocal = false>
+class schedulables_queue
 {
 public:
-    template<rpp::constraint::decayed_same_as<Fn> TFn, rpp::constraint::decayed_same_as<TObs> TTObs, typename... TArgs>
-    explicit specific_schedulable(const time_point& time_point, TFn&& in_fn, TTObs&& in_obs, TArgs&&... in_args)
-        : schedulable_base{time_point}
-        , m_args(std::forward<TTObs>(in_obs), std::forward<TArgs>(in_args)...)
-        , m_fn{std::forward<TFn>(in_fn)}
+    template<rpp::constraint::observer TObs, typename... Args, constraint::schedulable_fn<TObs, Args...> Fn>
+    void emplace(const time_point& timepoint, Fn&& fn, TObs&& obs, Args&&... args)
     {
+        if constexpr (ThreadLocal)
+            m_backend.push(make_thread_local_schedulable<std::decay_t<Fn>, std::decay_t<TObs>, std::decay_t<Args>...>(timepoint, std::forward<Fn>(fn), std::forward<TObs>(obs), std::forward<Args>(args)...));
+        else
+            m_backend.push(make_schedulable<std::decay_t<Fn>, std::decay_t<TObs>, std::decay_t<Args>...>(timepoint, std::forward<Fn>(fn), std::forward<TObs>(obs), std::forward<Args>(args)...));
     }
 
-    optional_duration operator()() override { return std::apply(m_fn, m_args); }
-    bool              is_disposed() const override { return std::get<0>(m_args).is_disposed(); }
+    void emplace(const time_point& timepoint, schedulable_ptr&& schedulable)
+    {
+        if (!schedulable)
+            return;
+
+        schedulable->set_timepoint(timepoint);
+        m_backend.push(std::move(schedulable));
+    }
+
+    bool is_empty() const { return m_backend.is_empty(); }
+
+    time_point get_top_timepoint() { return m_backend.get_top_timepoint(); }
+
+    schedulable_ptr pop() { return m_backend.pop(); }
 
 private:
-    std::tuple<TObs, Args...> m_args;
-    RPP_NO_UNIQUE_ADDRESS Fn  m_fn;
+    RPP_NO_UNIQUE_ADDRESS Backend m_backend{};
 };
 
-class schedulables_queue 
+/**
+ * @brief Thread-safe queue of schedulables dispatched by thread(s) owning it. Used as storage for threaded schedulers.
+ * @details Producers never lock: schedulables are pushed to the lock-free mpsc_queue ("intake") and mutex is taken only to wake up sleeping dispatcher.
+ * Dispatcher (holder of the mutex) splices intake to the timing_wheel in batches, so scheduling is O(1) independently of amount of pending schedulables.
+ * Schedulables can be scheduled as part of `group` to erase them eagerly via `erase` (for example, when worker is disposed) instead of keeping them till their time_point.
+ * Disposing of queue drops all its schedulables and wakes up dispatching thread.
+ */
+class queue final : public rpp::base_disposable
 {
+    using storage = timing_wheel<>;
+
+    template<typename Fn>
+    struct grouped_fn
+    {
+        RPP_NO_UNIQUE_ADDRESS Fn fn;
+
+        template<typename TObs, typename... Args>
+        optional_duration operator()(TObs& obs, const std::shared_ptr<storage::group>&, Args&... args) { return fn(obs, args...); }
+    };
+
 public:
+    using group = storage::group;
+
+    queue() = default;
+
     template<rpp::constraint::observer TObs, typename... Args, constraint::schedulable_fn<TObs, Args...> Fn>
-    void emplace(const time_point& timepoint, Fn&& fn, TObs&& obs, Args&&... args)
+    void emplace(const duration duration, Fn&& fn, TObs&& obs, Args&&... args)
+    {
+        emplace_impl(nullptr, duration, std::forward<Fn>(fn), std::forward<TObs>(obs), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Emplaces schedulable as part of group. Schedulable keeps group alive while it is pending or executed.
+     */
+    template<rpp::constraint::observer TObs, typename... Args, constraint::schedulable_fn<TObs, Args...> Fn>
+    void emplace(const std::shared_ptr<group>& g, const duration duration, Fn&& fn, TObs&& obs, Args&&... args)
     {
-        using schedulable_type = specific_schedulable<std::decay_t<Fn>, std::decay_t<TObs>, std::decay_t<Args>...>;
+        emplace_impl(g.get(), duration, grouped_fn<std::decay_t<Fn>>{std::forward<Fn>(fn)}, std::forward<TObs>(obs), g, std::forward<Args>(args)...);
+    }
 
-        emplace_impl(std::make_shared<schedulable_type>(timepoint, std::forward<Fn>(fn), std::forward<TObs>(obs), std::forward<Args>(args)...));
+    /**
+     * @brief Erases all pending schedulables of group. Any further schedulables of this group are ignored.
+     */
+    void erase(group& g)
+    {
+        std::vector<schedulable_ptr> erased{};
+        std::unique_lock             lock{m_mutex};
+        splice(lock);
+        // disposed queue already dropped everything
+        if (!is_disposed())
+            m_queue.erase(g, erased);
+        lock.unlock();
+        // erased schedulables destroyed after unlocking due to they could own last references to something using this queue
     }
 
-    void emplace(const time_point& timepoint, std::shared_ptr<schedulable_base>&& schedulable)
+    bool is_empty()
     {
-        if (!schedulable)
-            return;
+        std::unique_lock lock{m_mutex};
+        splice(lock);
+        return m_queue.is_empty() && m_intake.is_empty();
+    }
 
-        schedulable->set_timepoint(timepoint);
-        emplace_impl(std::move(schedulable));
+    /**
+     * @brief Executes one schedulable if its time_point is already reached. Never blocks waiting for schedulables.
+     * @returns true if ready schedulable was taken from queue (executed or dropped due to disposed observer)
+     */
+    bool dispatch_if_ready()
+    {
+        std::unique_lock lock{m_mutex};
+        splice(lock);
+        if (m_queue.is_empty() || m_queue.get_top_timepoint() > clock_type::now())
+            return false;
+
+        dispatch_top(lock);
+        return true;
     }
 
-    bool is_empty() const { return !m_head; }
+    /**
+     * @brief Blocks till earliest schedulable becomes ready and executes it (or drops it in case of disposed observer).
+     * @returns false without dispatching anything in case of queue disposed or queue is empty after `stop_when_empty` call
+     */
+    bool dispatch()
+    {
+        std::unique_lock lock{m_mutex};
+        while (true)
+        {
+            if (is_disposed())
+                return false;
+
+            splice(lock);
+            if (m_queue.is_empty())
+            {
+                if (m_stop_when_empty && m_intake.is_empty())
+                    return false;
+
+                wait(lock, std::nullopt);
+                continue;
+            }
+
+            if (const auto timepoint = m_queue.get_top_timepoint(); timepoint > clock_type::now())
+            {
+                wait(lock, timepoint);
+                continue;
+            }
+
+            dispatch_top(lock);
+            return true;
+        }
+    }
 
-    std::shared_ptr<schedulable_base> pop()
+    /**
+     * @brief Requests `dispatch` to return false as soon as queue becomes empty.
+     */
+    void stop_when_empty()
     {
-        return std::exchange(m_head, m_head->get_next());
+        {
+            std::lock_guard lock{m_mutex};
+            m_stop_when_empty = true;
+        }
+        m_cv.notify_all();
     }
 
 private:
-    void emplace_impl(std::shared_ptr<schedulable_base>&& schedulable)
+    template<typename Fn, typename TObs, typename... Args>
+    void emplace_impl(group* g, const duration duration, Fn&& fn, TObs&& obs, Args&&... args)
     {
-        if (!m_head || schedulable->get_timepoint() < m_head->get_timepoint())
-        {
-            schedulable->set_next(std::move(m_head));
-            m_head = std::move(schedulable);
+        if (obs.is_disposed() || is_disposed())
             return;
+
+        m_intake.push(make_schedulable<std::decay_t<Fn>, std::decay_t<TObs>, std::decay_t<Args>...>(clock_type::now() + duration, std::forward<Fn>(fn), std::forward<TObs>(obs), std::forward<Args>(args)...), g);
+
+        // seq_cst pairs with `wait` and `dispose_impl`: either they observe pushed schedulable or we observe sleeping dispatcher/disposed queue
+        if (m_intake_closed.load(std::memory_order_seq_cst))
+        {
+            // nobody is going to splice intake of disposed queue, so drop schedulable right now
+            std::unique_lock lock{m_mutex};
+            splice(lock);
+        }
+        else if (m_sleepers.load(std::memory_order_seq_cst) > 0)
+        {
+            {
+                std::lock_guard lock{m_mutex};
+            }
+            m_cv.notify_one();
         }
+    }
 
-        schedulable_base* current = m_head.get();
-        while (const auto& next = current->get_next())
+    // moves schedulables from intake to the timing_wheel. Expected to be called under lock: holder of the mutex is the only consumer of intake.
+    void splice(std::unique_lock<std::mutex>& lock)
+    {
+        std::vector<schedulable_ptr> dropped{};
+        while (true)
         {
-            if (schedulable->get_timepoint() < next->get_timepoint())
+            auto [schedulable, g] = m_intake.pop();
+            if (!schedulable)
                 break;
-            current = next.get();
+
+            if (is_disposed() || (g && g->is_erased()))
+                dropped.push_back(std::move(schedulable));
+            else
+                m_queue.push(std::move(schedulable), g);
+        }
+
+        if (!dropped.empty())
+        {
+            // schedulable could own last references to something using this queue
+            lock.unlock();
+            dropped.clear();
+            lock.lock();
+        }
+    }
+
+    void wait(std::unique_lock<std::mutex>& lock, const std::optional<time_point>& deadline)
+    {
+        m_sleepers.fetch_add(1, std::memory_order_seq_cst);
+        if (!m_intake.is_empty())
+        {
+            // producer is in the middle of push
+            lock.unlock();
+            std::this_thread::yield();
+            lock.lock();
+        }
+        else if (deadline)
+            m_cv.wait_until(lock, deadline.value());
+        else
+            m_cv.wait(lock);
+        m_sleepers.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void dispatch_top(std::unique_lock<std::mutex>& lock)
+    {
+        // group is alive while schedulable is alive
+        auto [top, g] = m_queue.pop_with_group();
+        lock.unlock();
+
+        if (!top->is_disposed())
+        {
+            if (const auto duration = (*top)())
+            {
+                lock.lock();
+                if (!is_disposed() && !(g && g->is_erased()))
+                {
+                    top->set_timepoint(clock_type::now() + duration.value());
+                    m_queue.push(std::move(top), g);
+                    return;
+                }
+                lock.unlock();
+            }
         }
+        // schedulable could own last references to something disposing this queue
+        top.reset();
+        lock.lock();
+    }
 
-        current->update_next(std::move(schedulable));
+    void dispose_impl() override
+    {
+        m_intake_closed.store(true, std::memory_order_seq_cst);
+
+        storage queue{};
+        {
+            std::unique_lock lock{m_mutex};
+            std::swap(queue, m_queue);
+            // drops everything: any producer not observed here observes closed intake and drops its schedulable by itself
+            splice(lock);
+            while (!m_intake.is_empty())
+            {
+                lock.unlock();
+                std::this_thread::yield();
+                lock.lock();
+                splice(lock);
+            }
+        }
+        m_cv.notify_all();
     }
+
 private:
-    std::shared_ptr<schedulable_base> m_head{};
+    storage                 m_queue{};
+    mpsc_queue<group>       m_intake{};
+    std::mutex              m_mutex{};
+    std::condition_variable m_cv{};
+    std::atomic_size_t      m_sleepers{};
+    std::atomic_bool        m_intake_closed{};
+    bool                    m_stop_when_empty{};
 };
-
-// class queue final : public base_disposable
-// {
-// public:
-//     queue() = default;
-//     ~queue() override noexcept  { dispose(); }
-
-//     template<rpp::constraint::observer TObs, typename...Args, constraint::schedulable_fn<TObs, Args...> Fn>
-//     void emplace(const duration duration, Fn&& fn, TObs&& obs, Args&&...args)
-//     {
-//         emplace(duration, schedulable_wrapper{std::forward<Fn>(fn), std::forward<TObs>(obs), std::forward<Args>(args)...});
-//     }
-
-//     void emplace(const duration duration, schedulable_wrapper&& wrapper)
-//     {
-//         {
-//             std::lock_guard lock{m_mutex};
-//             if (!is_disposed())
-//                 m_queue.emplace(clock_type::now()+duration, m_current_id++,std::move(wrapper));
-//         }
-//         m_cv.notify_one();
-//     }
-
-//     bool is_empty() const
-//     {
-//         std::lock_guard lock{ m_mutex };
-//         return m_queue.empty();
-//     }
-
-//     bool dispatch_if_ready()
-//     {
-//         std::unique_lock lock{ m_mutex };
-//         return dispatch_if_ready_impl(lock);
-//     }
-
-//     void dispatch()
-//     {
-//         while (!is_disposed())
-//         {
-//             std::unique_lock lock{m_mutex};
-//             m_cv.wait(lock, [&] { return !m_queue.empty() || is_disposed(); });
-
-//             if (m_queue.empty())
-//                 continue;
-
-//             if (m_queue.top().get_function().is_disposed())
-//             {
-//                 m_queue.pop();
-//                 return;
-//             }
-
-//             if (m_cv.wait_until(lock,
-//                                 m_queue.top().get_time_point(),
-//                                 [&] { return dispatch_if_ready_impl(lock) || is_disposed(); }))
-//                 return;
-//         }
-//     }
-
-// private:
-//     bool dispatch_if_ready_impl(std::unique_lock<std::mutex>& lock)
-//     {
-//         if (!is_any_ready_schedulable_unsafe())
-//             return false;
-
-//         auto fn = m_queue.top().get_function();
-//         m_queue.pop();
-//         lock.unlock();
-
-//         if (!fn.is_disposed())
-//         {
-//             if (const auto duration = fn())
-//             {
-//                 emplace(duration.value(), std::move(fn));
-//             }
-//         }
-//         return true;
-//     }
-
-//     bool is_any_ready_schedulable_unsafe()
-//     {
-//         return !m_queue.empty() && m_queue.top().get_time_point() <= clock_type::now();
-//     }
-
-//     void dispose_impl() override
-//     {
-//         {
-//             std::lock_guard lock{m_mutex};
-//             m_queue = std::priority_queue<schedulable>{};
-//         }
-//         m_cv.notify_one();
-//     }
-
-// private:
-//     std::priority_queue<schedulable> m_queue{};
-//     mutable std::mutex               m_mutex{};
-//     std::condition_variable          m_cv{};
-//     size_t                           m_current_id{};
-// };
-}
\ No newline at end of file
+} // namespace rpp::schedulers::details
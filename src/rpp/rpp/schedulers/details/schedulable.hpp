@@ -0,0 +1,158 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2023 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <rpp/defs.hpp>
+#include <rpp/memory_model.hpp>
+#include <rpp/utils/constraints.hpp>
+#include <rpp/utils/mpsc_queue.hpp>
+#include <rpp/utils/utils.hpp>
+#include <rpp/schedulers/fwd.hpp>
+#include <rpp/schedulers/details/schedulable_pool.hpp>
+
+#include <atomic>
+#include <concepts>
+#include <exception>
+#include <memory>
+#include <memory_resource>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace rpp::schedulers::details
+{
+/**
+ * @brief Intrusive link of schedulable used by mpsc_queue, so passing schedulable between threads needs no extra allocations.
+ */
+struct mpsc_link : rpp::details::mpsc_node
+{
+    void* mpsc_context{};
+};
+
+class schedulable_base : public mpsc_link
+{
+public:
+    explicit schedulable_base(const time_point& time_point) : m_time_point{time_point} {}
+
+    virtual optional_duration operator()()        = 0;
+    virtual bool              is_disposed() const = 0;
+    // destroys schedulable and returns its memory back to the schedulable_pool (or to memory resource it was allocated from)
+    virtual void              destroy() noexcept  = 0;
+
+    time_point get_timepoint() const { return m_time_point; }
+    void       set_timepoint(const time_point& timepoint) { m_time_point = timepoint; }
+
+protected:
+    ~schedulable_base() noexcept = default;
+
+private:
+    time_point m_time_point;
+};
+
+/**
+ * @brief Schedulable keeping function and its arguments.
+ * @tparam InArena schedulable is allocated from memory resource of rpp::memory_model::arena_scope instead of schedulable_pool
+ */
+template<bool InArena, rpp::constraint::decayed_type Fn, rpp::constraint::observer TObs, rpp::constraint::decayed_type... Args>
+    requires constraint::schedulable_fn<Fn, TObs, Args...>
+class specific_schedulable final : public schedulable_base
+{
+public:
+    using resource_type = std::conditional_t<InArena, std::pmr::memory_resource*, rpp::utils::none>;
+
+    template<rpp::constraint::decayed_same_as<Fn> TFn, rpp::constraint::decayed_same_as<TObs> TTObs, typename... TArgs>
+    explicit specific_schedulable(resource_type resource, const time_point& time_point, TFn&& in_fn, TTObs&& in_obs, TArgs&&... in_args)
+        : schedulable_base{time_point}
+        , m_args(std::forward<TTObs>(in_obs), std::forward<TArgs>(in_args)...)
+        , m_fn{std::forward<TFn>(in_fn)}
+        , m_resource{resource}
+    {
+    }
+
+    optional_duration operator()() override { return std::apply(m_fn, m_args); }
+    bool              is_disposed() const override { return std::get<0>(m_args).is_disposed(); }
+    void              destroy() noexcept override
+    {
+        if constexpr (InArena)
+        {
+            auto* resource = m_resource;
+            std::destroy_at(this);
+            resource->deallocate(this, sizeof(specific_schedulable), alignof(specific_schedulable));
+        }
+        else
+        {
+            schedulable_pool::destroy(this);
+        }
+    }
+
+private:
+    std::tuple<TObs, Args...>                 m_args;
+    RPP_NO_UNIQUE_ADDRESS Fn                  m_fn;
+    RPP_NO_UNIQUE_ADDRESS resource_type       m_resource;
+};
+
+struct schedulable_deleter
+{
+    void operator()(schedulable_base* schedulable) const noexcept { schedulable->destroy(); }
+};
+
+/**
+ * @brief Unique owner of schedulable. Schedulable always has exactly one owner (queue or thread executing it), so no reference counting is needed.
+ */
+using schedulable_ptr = std::unique_ptr<schedulable_base, schedulable_deleter>;
+
+template<rpp::constraint::decayed_type Fn, rpp::constraint::observer TObs, rpp::constraint::decayed_type... Args, typename... TArgs>
+schedulable_ptr make_schedulable(const time_point& timepoint, TArgs&&... args)
+{
+    return schedulable_ptr{schedulable_pool::create<specific_schedulable<false, Fn, TObs, Args...>>(rpp::utils::none{}, timepoint, std::forward<TArgs>(args)...)};
+}
+
+/**
+ * @brief Same as make_schedulable, but schedulable is allocated from memory resource of active rpp::memory_model::arena_scope (if any).
+ * @warning Resource of scope is not expected to be thread-safe: use it only for schedulables executed and destroyed by current thread.
+ */
+template<rpp::constraint::decayed_type Fn, rpp::constraint::observer TObs, rpp::constraint::decayed_type... Args, typename... TArgs>
+schedulable_ptr make_thread_local_schedulable(const time_point& timepoint, TArgs&&... args)
+{
+    auto* resource = rpp::memory_model::arena_scope::get_resource();
+    if (!resource)
+        return make_schedulable<Fn, TObs, Args...>(timepoint, std::forward<TArgs>(args)...);
+
+    using schedulable = specific_schedulable<true, Fn, TObs, Args...>;
+
+    void* memory = resource->allocate(sizeof(schedulable), alignof(schedulable));
+    RPP_TRY
+    {
+        return schedulable_ptr{::new (memory) schedulable(resource, timepoint, std::forward<TArgs>(args)...)};
+    }
+    RPP_CATCH(...)
+    {
+        resource->deallocate(memory, sizeof(schedulable), alignof(schedulable));
+        std::rethrow_exception(std::current_exception());
+    }
+}
+} // namespace rpp::schedulers::details
+
+namespace rpp::schedulers::constraint
+{
+/**
+ * @brief Storage used by schedulables_queue to keep schedulables ordered by time_point.
+ * @details Backend obtains ownership over schedulable during `push` and returns schedulable with the earliest time_point during `pop`. `get_top_timepoint` returns time_point of such a schedulable without popping it (backend is allowed to reorganize its storage during this call).
+ * Schedulables with same time_point are expected to be returned in order of pushing.
+ */
+template<typename B>
+concept schedulables_queue_backend = requires(B& backend, const B& const_backend, rpp::schedulers::details::schedulable_ptr&& schedulable)
+{
+    backend.push(std::move(schedulable));
+    { backend.pop() } -> std::same_as<rpp::schedulers::details::schedulable_ptr>;
+    { backend.get_top_timepoint() } -> std::same_as<time_point>;
+    { const_backend.is_empty() } -> std::same_as<bool>;
+};
+} // namespace rpp::schedulers::constraint
@@ -0,0 +1,139 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2023 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <rpp/defs.hpp>
+
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace rpp::schedulers::details
+{
+/**
+ * @brief Per-thread cache of memory blocks used to allocate schedulables.
+ * @details Blocks are grouped into size classes with granularity of `alignof(std::max_align_t)`. Freed block is pushed to the free-list
+ * of the thread which frees it, so freeing block allocated by another thread needs no synchronization. Length of each free-list is limited
+ * to keep memory bounded in case of one thread allocates and another one frees. Objects not fitting any size class are allocated via global `operator new`.
+ */
+class schedulable_pool
+{
+    static constexpr size_t s_granularity        = alignof(std::max_align_t);
+    static constexpr size_t s_size_classes_count = 32;
+    static constexpr size_t s_max_cached_blocks  = 64;
+
+    struct free_block
+    {
+        free_block* next;
+    };
+
+    struct free_list
+    {
+        free_block* head;
+        size_t      size;
+    };
+
+    // kept trivially destructible to stay accessible during destruction of other thread_local objects
+    struct cache
+    {
+        std::array<free_list, s_size_classes_count> lists;
+        bool                                        is_destroyed;
+    };
+
+    struct cache_cleaner
+    {
+        ~cache_cleaner() noexcept
+        {
+            auto& c = get_cache();
+            for (auto& list : c.lists)
+            {
+                while (list.head)
+                    ::operator delete(std::exchange(list.head, list.head->next));
+                list.size = 0;
+            }
+            c.is_destroyed = true;
+        }
+    };
+
+    static cache& get_cache()
+    {
+        static thread_local cache         s_cache{};
+        static thread_local cache_cleaner s_cleaner{};
+        return s_cache;
+    }
+
+    static constexpr size_t get_size_class(size_t size) { return (size - 1) / s_granularity; }
+
+    template<typename T>
+    static constexpr bool is_poolable = alignof(T) <= s_granularity && get_size_class(sizeof(T)) < s_size_classes_count;
+
+public:
+    template<typename T, typename... Args>
+    static T* create(Args&&... args)
+    {
+        if constexpr (!is_poolable<T>)
+        {
+            return new T(std::forward<Args>(args)...);
+        }
+        else
+        {
+            void* memory = allocate(get_size_class(sizeof(T)));
+            RPP_TRY
+            {
+                return ::new (memory) T(std::forward<Args>(args)...);
+            }
+            RPP_CATCH(...)
+            {
+                deallocate(memory, get_size_class(sizeof(T)));
+                std::rethrow_exception(std::current_exception());
+            }
+        }
+    }
+
+    template<typename T>
+    static void destroy(T* ptr) noexcept
+    {
+        if constexpr (!is_poolable<T>)
+        {
+            delete ptr;
+        }
+        else
+        {
+            std::destroy_at(ptr);
+            deallocate(ptr, get_size_class(sizeof(T)));
+        }
+    }
+
+private:
+    static void* allocate(size_t size_class)
+    {
+        auto& list = get_cache().lists[size_class];
+        if (!list.head)
+            return ::operator new((size_class + 1) * s_granularity);
+
+        --list.size;
+        return std::exchange(list.head, list.head->next);
+    }
+
+    static void deallocate(void* ptr, size_t size_class) noexcept
+    {
+        auto& c    = get_cache();
+        auto& list = c.lists[size_class];
+        if (c.is_destroyed || list.size >= s_max_cached_blocks)
+            return ::operator delete(ptr);
+
+        ++list.size;
+        list.head = ::new (ptr) free_block{list.head};
+    }
+};
+} // namespace rpp::schedulers::details
@@ -0,0 +1,356 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2023 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+#include <rpp/schedulers/details/schedulable.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace rpp::schedulers::details
+{
+/**
+ * @brief Hierarchical timing wheel keeping schedulables ordered by time_point. Satisfies rpp::schedulers::constraint::schedulables_queue_backend.
+ * @details Time is split into ticks of `Resolution`. Each level has 64 slots hashed by 6 bits of tick, so schedulable is placed to the slot of level
+ * matching the highest bits its tick differs from the current tick: `push` and erasing are O(1). During `pop`/`get_top_timepoint` wheel moves current tick
+ * directly to the earliest non-empty slot (via bitmaps of non-empty slots) and cascades its schedulables to lower levels. Schedulables of the current tick
+ * are kept in small heap ordered by exact time_point and sequence number of insertion, so order is the same as for d_ary_heap.
+ *
+ * Schedulables can be pushed as part of `group` to erase all pending schedulables of the group at once without waiting for their time_point.
+ */
+template<typename Resolution = std::chrono::milliseconds>
+class timing_wheel
+{
+    static constexpr size_t s_slot_bits    = 6;
+    static constexpr size_t s_slots_count  = size_t{1} << s_slot_bits;
+    static constexpr size_t s_levels_count = 6;
+    static constexpr size_t s_npos         = std::numeric_limits<size_t>::max();
+
+    enum class location : uint8_t
+    {
+        free,
+        wheel,
+        overflow,
+        ready,
+        erased_ready // erased, but still referenced by heap of ready schedulables
+    };
+
+    struct link
+    {
+        size_t prev = s_npos;
+        size_t next = s_npos;
+    };
+
+public:
+    /**
+     * @brief Set of schedulables of the wheel which can be erased together.
+     * @warning Group can be used only with one wheel and only while it has any pending schedulable.
+     */
+    class group
+    {
+    public:
+        group() = default;
+
+        group(const group&) = delete;
+        group(group&&)      = delete;
+
+        bool is_erased() const { return m_erased; }
+
+    private:
+        friend class timing_wheel;
+
+        size_t m_head   = s_npos;
+        bool   m_erased = false;
+    };
+
+    void push(schedulable_ptr&& schedulable) { push(std::move(schedulable), nullptr); }
+
+    void push(schedulable_ptr&& schedulable, group* owner)
+    {
+        const auto timepoint = schedulable->get_timepoint();
+        if (m_size == 0 && m_ready.empty())
+        {
+            m_origin  = timepoint;
+            m_current = 0;
+        }
+
+        const size_t index = allocate_node();
+        auto&        n     = m_nodes[index];
+        n.timepoint        = timepoint;
+        n.id               = m_current_id++;
+        n.tick             = std::chrono::floor<Resolution>(timepoint - m_origin).count();
+        n.schedulable      = std::move(schedulable);
+        n.owner            = owner;
+        if (owner)
+            link_front(owner->m_head, index, &node::in_group);
+
+        place(index);
+        ++m_size;
+    }
+
+    schedulable_ptr pop() { return pop_with_group().first; }
+
+    /**
+     * @brief Pops earliest schedulable and group it was pushed with
+     */
+    std::pair<schedulable_ptr, group*> pop_with_group()
+    {
+        prepare_top();
+
+        const size_t index = m_ready.front().index;
+        std::pop_heap(m_ready.begin(), m_ready.end(), ready_comparator{});
+        m_ready.pop_back();
+
+        auto& n     = m_nodes[index];
+        auto* owner = n.owner;
+        if (owner)
+            unlink(owner->m_head, index, &node::in_group);
+
+        auto result = std::move(n.schedulable);
+        free_node(index);
+        --m_size;
+        return {std::move(result), owner};
+    }
+
+    bool is_empty() const { return m_size == 0; }
+
+    time_point get_top_timepoint()
+    {
+        prepare_top();
+        return m_ready.front().timepoint;
+    }
+
+    /**
+     * @brief Removes all pending schedulables of group and marks group as erased.
+     * @param erased obtains removed schedulables to let caller destroy them outside of any locks
+     */
+    void erase(group& g, std::vector<schedulable_ptr>& erased)
+    {
+        for (size_t index = std::exchange(g.m_head, s_npos); index != s_npos;)
+        {
+            auto& n = m_nodes[index];
+            const size_t next = n.in_group.next;
+            n.in_group = link{};
+            n.owner    = nullptr;
+            erased.push_back(std::move(n.schedulable));
+
+            switch (n.where)
+            {
+                case location::wheel:
+                    unlink(m_slots[n.level][n.slot], index, &node::in_slot);
+                    if (m_slots[n.level][n.slot] == s_npos)
+                        m_bitmaps[n.level] &= ~(uint64_t{1} << n.slot);
+                    free_node(index);
+                    break;
+                case location::overflow:
+                    unlink(m_overflow, index, &node::in_slot);
+                    free_node(index);
+                    break;
+                case location::ready:
+                    n.where = location::erased_ready;
+                    break;
+                case location::free:
+                case location::erased_ready:
+                    break;
+            }
+            --m_size;
+            index = next;
+        }
+        g.m_erased = true;
+    }
+
+private:
+    struct node
+    {
+        time_point      timepoint{};
+        size_t          id{};
+        int64_t         tick{};
+        schedulable_ptr schedulable{};
+        group*          owner{};
+        link            in_slot{};
+        link            in_group{};
+        size_t          level{};
+        size_t          slot{};
+        location        where{location::free};
+    };
+
+    // keys are copied to entries of heap to avoid indirection to nodes during sift
+    struct ready_entry
+    {
+        time_point timepoint;
+        size_t     id;
+        size_t     index;
+    };
+
+    struct ready_comparator
+    {
+        // std heaps are max-heaps, so "less" means "later"
+        bool operator()(const ready_entry& l, const ready_entry& r) const
+        {
+            return r.timepoint < l.timepoint || (r.timepoint == l.timepoint && r.id < l.id);
+        }
+    };
+
+    size_t allocate_node()
+    {
+        if (m_free == s_npos)
+        {
+            m_nodes.emplace_back();
+            return m_nodes.size() - 1;
+        }
+        return std::exchange(m_free, m_nodes[m_free].in_slot.next);
+    }
+
+    void free_node(size_t index)
+    {
+        auto& n         = m_nodes[index];
+        n.where         = location::free;
+        n.in_slot       = link{s_npos, m_free};
+        m_free          = index;
+    }
+
+    void link_front(size_t& head, size_t index, link node::*member)
+    {
+        (m_nodes[index].*member) = link{s_npos, head};
+        if (head != s_npos)
+            (m_nodes[head].*member).prev = index;
+        head = index;
+    }
+
+    void unlink(size_t& head, size_t index, link node::*member)
+    {
+        const auto l = std::exchange(m_nodes[index].*member, link{});
+        if (l.prev != s_npos)
+            (m_nodes[l.prev].*member).next = l.next;
+        else
+            head = l.next;
+
+        if (l.next != s_npos)
+            (m_nodes[l.next].*member).prev = l.prev;
+    }
+
+    void place(size_t index)
+    {
+        auto& n = m_nodes[index];
+        if (n.tick <= m_current)
+        {
+            n.where = location::ready;
+            m_ready.push_back(ready_entry{n.timepoint, n.id, index});
+            std::push_heap(m_ready.begin(), m_ready.end(), ready_comparator{});
+            return;
+        }
+
+        const auto   diff  = static_cast<uint64_t>(n.tick) ^ static_cast<uint64_t>(m_current);
+        const size_t level = (static_cast<size_t>(std::bit_width(diff)) - 1) / s_slot_bits;
+        if (level >= s_levels_count)
+        {
+            n.where = location::overflow;
+            link_front(m_overflow, index, &node::in_slot);
+            return;
+        }
+
+        n.where = location::wheel;
+        n.level = level;
+        n.slot  = get_digit(n.tick, level);
+        link_front(m_slots[level][n.slot], index, &node::in_slot);
+        m_bitmaps[level] |= uint64_t{1} << n.slot;
+    }
+
+    static size_t get_digit(int64_t tick, size_t level)
+    {
+        return static_cast<size_t>((static_cast<uint64_t>(tick) >> (level * s_slot_bits)) & (s_slots_count - 1));
+    }
+
+    // ensures top of heap of ready schedulables is the earliest pending schedulable
+    void prepare_top()
+    {
+        while (true)
+        {
+            while (!m_ready.empty() && m_nodes[m_ready.front().index].where == location::erased_ready)
+            {
+                const size_t index = m_ready.front().index;
+                std::pop_heap(m_ready.begin(), m_ready.end(), ready_comparator{});
+                m_ready.pop_back();
+                free_node(index);
+            }
+
+            if (!m_ready.empty())
+                return;
+
+            advance();
+        }
+    }
+
+    // moves current tick to the earliest non-empty slot and cascades its schedulables
+    void advance()
+    {
+        for (size_t level = 0; level < s_levels_count; ++level)
+        {
+            const size_t   digit = get_digit(m_current, level);
+            const uint64_t later = digit + 1 < s_slots_count ? m_bitmaps[level] & (~uint64_t{0} << (digit + 1)) : 0;
+            if (!later)
+                continue;
+
+            const auto slot       = static_cast<size_t>(std::countr_zero(later));
+            const auto lower_mask = (uint64_t{1} << ((level + 1) * s_slot_bits)) - 1;
+            m_current             = static_cast<int64_t>((static_cast<uint64_t>(m_current) & ~lower_mask) | (uint64_t{slot} << (level * s_slot_bits)));
+
+            m_bitmaps[level] &= ~(uint64_t{1} << slot);
+            cascade(std::exchange(m_slots[level][slot], s_npos));
+            return;
+        }
+
+        int64_t min_tick = std::numeric_limits<int64_t>::max();
+        for (size_t index = m_overflow; index != s_npos; index = m_nodes[index].in_slot.next)
+            min_tick = std::min(min_tick, m_nodes[index].tick);
+
+        m_current = min_tick;
+        cascade(std::exchange(m_overflow, s_npos));
+    }
+
+    void cascade(size_t head)
+    {
+        while (head != s_npos)
+        {
+            const size_t index = head;
+            head                       = m_nodes[index].in_slot.next;
+            m_nodes[index].in_slot     = link{};
+            place(index);
+        }
+    }
+
+private:
+    std::vector<node>                                         m_nodes{};
+    std::vector<ready_entry>                                  m_ready{};
+    std::array<std::array<size_t, s_slots_count>, s_levels_count> m_slots = make_empty_slots();
+    std::array<uint64_t, s_levels_count>                      m_bitmaps{};
+    size_t                                                    m_overflow = s_npos;
+    size_t                                                    m_free     = s_npos;
+    size_t                                                    m_size{};
+    size_t                                                    m_current_id{};
+    time_point                                                m_origin{};
+    int64_t                                                   m_current{};
+
+    static constexpr std::array<std::array<size_t, s_slots_count>, s_levels_count> make_empty_slots()
+    {
+        std::array<std::array<size_t, s_slots_count>, s_levels_count> result{};
+        for (auto& level : result)
+            level.fill(s_npos);
+        return result;
+    }
+};
+} // namespace rpp::schedulers::details
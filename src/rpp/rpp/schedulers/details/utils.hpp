@@ -15,6 +15,41 @@
 
 namespace rpp::schedulers::details
 {
+/**
+ * @brief Part of waiting performed via spinning instead of sleeping for schedulers waiting in the caller thread. Thread-local, zero by default.
+ * @details `std::this_thread::sleep_for` is allowed to oversleep and for short delays it usually oversleeps for tens of microseconds, so last part of waiting
+ * can be spent in spinning to wake up in time.
+ */
+inline duration& get_spin_before_sleep_threshold()
+{
+    static thread_local duration s_threshold{};
+    return s_threshold;
+}
+
+inline void sleep_until(const time_point timepoint)
+{
+    const auto threshold = get_spin_before_sleep_threshold();
+    if (threshold == duration::zero())
+    {
+        std::this_thread::sleep_until(timepoint);
+        return;
+    }
+
+    if (const auto now = clock_type::now(); timepoint - now > threshold)
+        std::this_thread::sleep_for(timepoint - now - threshold);
+
+    while (clock_type::now() < timepoint)
+        std::this_thread::yield();
+}
+
+inline void sleep_for(const duration duration)
+{
+    if (get_spin_before_sleep_threshold() == duration::zero())
+        std::this_thread::sleep_for(duration);
+    else
+        sleep_until(clock_type::now() + duration);
+}
+
 /**
  * @brief Makes immediate-like scheduling for provided arguments
  * @returns nullopt in case of subscription unsubscribed or schedulable doesn't requested to re-schedule, some value - in case of condition failed but still some duration to delay action
@@ -33,7 +68,7 @@ optional_duration immediate_scheduling_while_condition(duration
 
         if (duration > duration::zero())
         {
-            std::this_thread::sleep_for(duration);
+            details::sleep_for(duration);
 
             if (obs.is_disposed())
                 return std::nullopt;
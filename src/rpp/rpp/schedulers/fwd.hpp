@@ -48,6 +48,10 @@ class worker;
 
 class immediate;
 class current_thread;
+class new_thread;
+class run_loop;
+class thread_pool;
+class virtual_time;
 }
 
 namespace rpp::schedulers::constraint
@@ -0,0 +1,81 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+#include <rpp/schedulers/details/queue.hpp>
+#include <rpp/schedulers/details/worker.hpp>
+#include <rpp/disposables/disposable_wrapper.hpp>
+
+#include <memory>
+#include <thread>
+
+namespace rpp::schedulers
+{
+/**
+ * @brief Scheduler which schedules execution of schedulables to the new dedicated thread per each worker.
+ * @details Thread of worker processes schedulables in order of time_point and then in order of scheduling. Thread is finished when disposable of worker is disposed
+ * or when all copies of worker are destroyed and there is no any schedulables left in its queue.
+ *
+ * @par Example
+ * @code{.cpp}
+ * rpp::source::just(rpp::schedulers::new_thread{}, 1, 2, 3).subscribe([](int v) { std::cout << v << std::endl; });
+ * @endcode
+ *
+ * @ingroup schedulers
+ */
+class new_thread
+{
+    class state
+    {
+    public:
+        state()
+        {
+            std::thread{[queue = m_queue] {
+                while (queue->dispatch()) {}
+            }}.detach();
+        }
+
+        state(const state&) = delete;
+        state(state&&)      = delete;
+
+        ~state() noexcept { m_queue->stop_when_empty(); }
+
+        const std::shared_ptr<details::queue>& get_queue() const { return m_queue; }
+
+    private:
+        std::shared_ptr<details::queue> m_queue = std::make_shared<details::queue>();
+    };
+
+public:
+    class worker_strategy
+    {
+    public:
+        worker_strategy() = default;
+
+        template<rpp::constraint::observer TObs, typename... Args, constraint::schedulable_fn<TObs, Args...> Fn>
+        void defer_for(duration duration, Fn&& fn, TObs&& obs, Args&&... args) const
+        {
+            m_state->get_queue()->emplace(duration, std::forward<Fn>(fn), std::forward<TObs>(obs), std::forward<Args>(args)...);
+        }
+
+        rpp::disposable_wrapper get_disposable() const { return rpp::disposable_wrapper{m_state->get_queue()}; }
+
+    private:
+        std::shared_ptr<state> m_state = std::make_shared<state>();
+    };
+
+    static rpp::schedulers::worker<worker_strategy> create_worker()
+    {
+        return rpp::schedulers::worker<worker_strategy>{};
+    }
+};
+} // namespace rpp::schedulers
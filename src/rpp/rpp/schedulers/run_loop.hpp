@@ -0,0 +1,102 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+#include <rpp/schedulers/details/queue.hpp>
+#include <rpp/schedulers/details/worker.hpp>
+#include <rpp/disposables/base_disposable.hpp>
+#include <rpp/disposables/disposable_wrapper.hpp>
+
+#include <memory>
+
+namespace rpp::schedulers
+{
+/**
+ * @brief Scheduler which queues schedulables to the queue dispatched manually by application via `dispatch()`/`dispatch_if_ready()` from its own loop.
+ * @details All workers and copies of run_loop share same queue. Schedulables are processed in order of time_point and then in order of scheduling.
+ * Disposing of worker's disposable eagerly removes all pending schedulables of this worker from the queue.
+ *
+ * @par Example
+ * @code{.cpp}
+ * rpp::schedulers::run_loop loop{};
+ * rpp::source::just(loop, 1, 2, 3).subscribe([](int v) { std::cout << v << std::endl; });
+ * while (!loop.is_empty())
+ *     loop.dispatch();
+ * @endcode
+ *
+ * @ingroup schedulers
+ */
+class run_loop
+{
+public:
+    class worker_strategy
+    {
+        class state final : public rpp::base_disposable
+        {
+        public:
+            explicit state(std::shared_ptr<details::queue> queue)
+                : m_queue{std::move(queue)} {}
+
+            const std::shared_ptr<details::queue>&        get_queue() const { return m_queue; }
+            const std::shared_ptr<details::queue::group>& get_group() const { return m_group; }
+
+        private:
+            void dispose_impl() override { m_queue->erase(*m_group); }
+
+        private:
+            std::shared_ptr<details::queue>        m_queue;
+            std::shared_ptr<details::queue::group> m_group = std::make_shared<details::queue::group>();
+        };
+
+    public:
+        explicit worker_strategy(std::shared_ptr<details::queue> queue)
+            : m_state{std::make_shared<state>(std::move(queue))} {}
+
+        template<rpp::constraint::observer TObs, typename... Args, constraint::schedulable_fn<TObs, Args...> Fn>
+        void defer_for(duration duration, Fn&& fn, TObs&& obs, Args&&... args) const
+        {
+            m_state->get_queue()->emplace(m_state->get_group(), duration, std::forward<Fn>(fn), std::forward<TObs>(obs), std::forward<Args>(args)...);
+        }
+
+        rpp::disposable_wrapper get_disposable() const { return rpp::disposable_wrapper{m_state}; }
+
+    private:
+        std::shared_ptr<state> m_state;
+    };
+
+    run_loop() = default;
+
+    rpp::schedulers::worker<worker_strategy> create_worker() const
+    {
+        return rpp::schedulers::worker<worker_strategy>{m_queue};
+    }
+
+    /**
+     * @brief Checks if there is any schedulable in queue (ready or delayed)
+     */
+    bool is_empty() const { return m_queue->is_empty(); }
+
+    /**
+     * @brief Executes one schedulable in case of its time_point is reached. Never blocks.
+     * @returns true if ready schedulable was taken from queue (executed or dropped due to disposed observer), so `while (loop.dispatch_if_ready()) {}` drains all ready schedulables
+     */
+    bool dispatch_if_ready() const { return m_queue->dispatch_if_ready(); }
+
+    /**
+     * @brief Blocks till earliest schedulable becomes ready and executes it.
+     */
+    void dispatch() const { m_queue->dispatch(); }
+
+private:
+    std::shared_ptr<details::queue> m_queue = std::make_shared<details::queue>();
+};
+} // namespace rpp::schedulers
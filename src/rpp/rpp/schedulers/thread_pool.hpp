@@ -0,0 +1,392 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/defs.hpp>
+#include <rpp/schedulers/fwd.hpp>
+#include <rpp/schedulers/details/queue.hpp>
+#include <rpp/schedulers/details/worker.hpp>
+#include <rpp/disposables/base_disposable.hpp>
+#include <rpp/disposables/disposable_wrapper.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace rpp::schedulers::details
+{
+class thread_pool_strand;
+
+/**
+ * @brief Threads of thread_pool with their own deques of strands ready to be executed.
+ * @details Each thread takes strands from the front of its own deque and steals from the front of deques of other threads when own one is empty.
+ * Strand waiting for the delayed schedulable is kept by the thread which executed it last time until its time_point.
+ */
+class thread_pool_state final : public std::enable_shared_from_this<thread_pool_state>
+{
+    struct thread_queue
+    {
+        std::mutex                                      mutex{};
+        std::deque<std::shared_ptr<thread_pool_strand>> strands{};
+    };
+
+    struct timer
+    {
+        time_point                          timepoint;
+        size_t                              generation;
+        std::shared_ptr<thread_pool_strand> strand;
+
+        bool operator>(const timer& other) const { return timepoint > other.timepoint; }
+    };
+
+public:
+    explicit thread_pool_state(size_t threads_count)
+        : m_queues(std::max(threads_count, size_t{1})) {}
+
+    void start()
+    {
+        for (size_t i = 0; i < m_queues.size(); ++i)
+            std::thread{[state = shared_from_this(), i] { state->run(i); }}.detach();
+    }
+
+    void stop()
+    {
+        {
+            std::lock_guard lock{m_sleep_mutex};
+            m_stopped = true;
+        }
+        m_cv.notify_all();
+    }
+
+    size_t get_next_home_index() { return m_next_home_index.fetch_add(1, std::memory_order_relaxed) % m_queues.size(); }
+
+    void submit(std::shared_ptr<thread_pool_strand> strand, size_t home_index)
+    {
+        // strands submitted from threads of this pool stay on the same thread to keep locality
+        const size_t index = s_current_state == this ? s_current_index : home_index;
+        {
+            std::lock_guard lock{m_queues[index].mutex};
+            m_queues[index].strands.push_back(std::move(strand));
+        }
+
+        m_pending.fetch_add(1, std::memory_order_seq_cst);
+        if (m_sleepers.load(std::memory_order_seq_cst) > 0)
+        {
+            {
+                std::lock_guard lock{m_sleep_mutex};
+            }
+            m_cv.notify_one();
+        }
+    }
+
+private:
+    void run(size_t index);
+
+    std::shared_ptr<thread_pool_strand> try_pop(size_t index)
+    {
+        for (size_t i = 0; i < m_queues.size(); ++i)
+        {
+            auto&           queue = m_queues[(index + i) % m_queues.size()];
+            std::lock_guard lock{queue.mutex};
+            if (queue.strands.empty())
+                continue;
+
+            auto strand = std::move(queue.strands.front());
+            queue.strands.pop_front();
+            m_pending.fetch_sub(1, std::memory_order_relaxed);
+            return strand;
+        }
+        return {};
+    }
+
+    // returns false in case of pool is stopped
+    bool wait_for_work(const std::vector<timer>& timers)
+    {
+        std::unique_lock lock{m_sleep_mutex};
+        if (m_stopped)
+            return false;
+
+        m_sleepers.fetch_add(1, std::memory_order_seq_cst);
+        const auto has_work = [&] { return m_pending.load(std::memory_order_seq_cst) > 0 || m_stopped; };
+        if (timers.empty())
+            m_cv.wait(lock, has_work);
+        else
+            m_cv.wait_until(lock, timers.front().timepoint, has_work);
+        m_sleepers.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+private:
+    inline static thread_local const thread_pool_state* s_current_state{};
+    inline static thread_local size_t                   s_current_index{};
+
+    std::vector<thread_queue> m_queues;
+    std::atomic_size_t        m_next_home_index{};
+    std::atomic_size_t        m_pending{};
+    std::atomic_size_t        m_sleepers{};
+
+    std::mutex              m_sleep_mutex{};
+    std::condition_variable m_cv{};
+    bool                    m_stopped{};
+};
+
+/**
+ * @brief Keeps threads of thread_pool alive: threads are stopped when last thread_pool object and last worker are destroyed.
+ */
+class thread_pool_owner
+{
+public:
+    explicit thread_pool_owner(size_t threads_count)
+        : m_state{std::make_shared<thread_pool_state>(threads_count)}
+    {
+        RPP_TRY
+        {
+            m_state->start();
+        }
+        RPP_CATCH(...)
+        {
+            m_state->stop();
+            std::rethrow_exception(std::current_exception());
+        }
+    }
+
+    thread_pool_owner(const thread_pool_owner&) = delete;
+    thread_pool_owner(thread_pool_owner&&)      = delete;
+
+    ~thread_pool_owner() noexcept { m_state->stop(); }
+
+    thread_pool_state& get_state() const { return *m_state; }
+
+private:
+    std::shared_ptr<thread_pool_state> m_state;
+};
+
+/**
+ * @brief Serial queue of schedulables of one worker of thread_pool.
+ * @details Strand is the unit of work-stealing: it is executed by at most one thread at a time, so schedulables of one worker are never
+ * executed concurrently and are dispatched in order of time_point and then in order of scheduling. Disposing of strand drops all its schedulables.
+ */
+class thread_pool_strand final : public rpp::base_disposable
+    , public std::enable_shared_from_this<thread_pool_strand>
+{
+    // amount of schedulables executed before giving a chance to other strands of the same thread
+    static constexpr size_t s_budget = 128;
+
+    enum class state
+    {
+        idle,    // no schedulables
+        queued,  // placed to the deque of some thread
+        running, // being executed by some thread
+        waiting  // kept by some thread till time_point of its earliest schedulable
+    };
+
+public:
+    explicit thread_pool_strand(std::shared_ptr<thread_pool_owner> owner)
+        : m_owner{std::move(owner)}
+        , m_home_index{m_owner->get_state().get_next_home_index()} {}
+
+    template<rpp::constraint::observer TObs, typename... Args, constraint::schedulable_fn<TObs, Args...> Fn>
+    void defer_for(duration duration, Fn&& fn, TObs&& obs, Args&&... args)
+    {
+        if (obs.is_disposed())
+            return;
+
+        const auto       timepoint = clock_type::now() + duration;
+        std::unique_lock lock{m_mutex};
+        if (is_disposed())
+            return;
+
+        m_queue.emplace(timepoint, std::forward<Fn>(fn), std::forward<TObs>(obs), std::forward<Args>(args)...);
+        if (m_state == state::idle || (m_state == state::waiting && timepoint < m_waiting_timepoint))
+        {
+            m_state = state::queued;
+            lock.unlock();
+            m_owner->get_state().submit(shared_from_this(), m_home_index);
+        }
+    }
+
+    /**
+     * @brief Executes ready schedulables of strand.
+     * @returns time_point and generation of waiting in case of strand waits for delayed schedulable
+     */
+    std::optional<std::pair<time_point, size_t>> drain()
+    {
+        std::unique_lock lock{m_mutex};
+        m_state = state::running;
+        for (size_t budget = s_budget;; --budget)
+        {
+            if (m_queue.is_empty())
+            {
+                m_state = state::idle;
+                return std::nullopt;
+            }
+
+            if (const auto timepoint = m_queue.get_top_timepoint(); timepoint > clock_type::now())
+            {
+                m_state             = state::waiting;
+                m_waiting_timepoint = timepoint;
+                return std::pair{timepoint, ++m_generation};
+            }
+
+            if (budget == 0)
+            {
+                m_state = state::queued;
+                lock.unlock();
+                m_owner->get_state().submit(shared_from_this(), m_home_index);
+                return std::nullopt;
+            }
+
+            auto top = m_queue.pop();
+            lock.unlock();
+
+            const auto duration = top->is_disposed() ? std::nullopt : (*top)();
+
+            lock.lock();
+            if (duration && !is_disposed())
+            {
+                m_queue.emplace(clock_type::now() + duration.value(), std::move(top));
+            }
+            else
+            {
+                // schedulable could own last references to something disposing this strand
+                lock.unlock();
+                top.reset();
+                lock.lock();
+            }
+        }
+    }
+
+    /**
+     * @brief Wakes up strand waiting for delayed schedulable
+     * @returns true if strand should be executed
+     */
+    bool wake_up(size_t generation)
+    {
+        std::lock_guard lock{m_mutex};
+        if (m_state != state::waiting || m_generation != generation)
+            return false;
+
+        m_state = state::queued;
+        return true;
+    }
+
+private:
+    void dispose_impl() override
+    {
+        schedulables_queue<> queue{};
+        {
+            std::lock_guard lock{m_mutex};
+            std::swap(queue, m_queue);
+        }
+    }
+
+private:
+    std::shared_ptr<thread_pool_owner> m_owner;
+    const size_t                       m_home_index;
+
+    std::mutex           m_mutex{};
+    schedulables_queue<> m_queue{};
+    state                m_state{state::idle};
+    time_point           m_waiting_timepoint{};
+    size_t               m_generation{};
+};
+
+inline void thread_pool_state::run(size_t index)
+{
+    s_current_state = this;
+    s_current_index = index;
+
+    std::vector<timer> timers{};
+    while (true)
+    {
+        const auto now = clock_type::now();
+        while (!timers.empty() && timers.front().timepoint <= now)
+        {
+            std::pop_heap(timers.begin(), timers.end(), std::greater<>{});
+            auto t = std::move(timers.back());
+            timers.pop_back();
+
+            if (t.strand->wake_up(t.generation))
+                submit(std::move(t.strand), index);
+        }
+
+        if (auto strand = try_pop(index))
+        {
+            if (const auto waiting = strand->drain())
+            {
+                timers.push_back(timer{waiting->first, waiting->second, std::move(strand)});
+                std::push_heap(timers.begin(), timers.end(), std::greater<>{});
+            }
+            continue;
+        }
+
+        if (!wait_for_work(timers))
+            return;
+    }
+}
+} // namespace rpp::schedulers::details
+
+namespace rpp::schedulers
+{
+/**
+ * @brief Schedules execution of schedulables to the fixed set of threads with work-stealing between them.
+ * @details Each worker is serial queue ("strand"): schedulables of one worker are never executed concurrently and are dispatched in order of time_point
+ * and then in order of scheduling, so emissions of one observer stay serialized. Different workers are balanced between threads: idle thread steals ready workers
+ * from busy ones. Threads are alive while any thread_pool object or any its worker is alive.
+ *
+ * @par Example
+ * @code{.cpp}
+ * rpp::source::just(rpp::schedulers::thread_pool{4}, 1, 2, 3).subscribe([](int v) { std::cout << v << std::endl; });
+ * @endcode
+ *
+ * @ingroup schedulers
+ */
+class thread_pool final
+{
+public:
+    class worker_strategy
+    {
+    public:
+        explicit worker_strategy(std::shared_ptr<details::thread_pool_strand> strand)
+            : m_strand{std::move(strand)} {}
+
+        template<rpp::constraint::observer TObs, typename... Args, constraint::schedulable_fn<TObs, Args...> Fn>
+        void defer_for(duration duration, Fn&& fn, TObs&& obs, Args&&... args) const
+        {
+            m_strand->defer_for(duration, std::forward<Fn>(fn), std::forward<TObs>(obs), std::forward<Args>(args)...);
+        }
+
+        rpp::disposable_wrapper get_disposable() const { return rpp::disposable_wrapper{m_strand}; }
+
+    private:
+        std::shared_ptr<details::thread_pool_strand> m_strand;
+    };
+
+    explicit thread_pool(size_t threads_count = std::thread::hardware_concurrency())
+        : m_owner{std::make_shared<details::thread_pool_owner>(threads_count)} {}
+
+    rpp::schedulers::worker<worker_strategy> create_worker() const
+    {
+        return rpp::schedulers::worker<worker_strategy>{std::make_shared<details::thread_pool_strand>(m_owner)};
+    }
+
+private:
+    std::shared_ptr<details::thread_pool_owner> m_owner;
+};
+} // namespace rpp::schedulers
@@ -0,0 +1,119 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+#include <rpp/schedulers/details/queue.hpp>
+#include <rpp/schedulers/details/worker.hpp>
+#include <rpp/disposables/disposable_wrapper.hpp>
+
+#include <algorithm>
+#include <memory>
+
+namespace rpp::schedulers
+{
+/**
+ * @brief Scheduler with virtual clock: schedulables are executed only during `advance_by`/`advance_to` in the caller thread and virtual clock jumps
+ * directly to time_point of each schedulable instead of sleeping, so hours of delayed work are processed in microseconds and deterministically.
+ * @details All workers and copies of virtual_time share same clock and queue. Schedulables are processed in order of time_point and then in order of scheduling.
+ * Delays of schedulables (including re-scheduling) are counted from virtual `now()`. Schedulables scheduled without delay are executed during the next `advance_by`/`advance_to` call.
+ *
+ * @warning virtual_time is not thread-safe: scheduling and advancing are expected to be done from one thread.
+ *
+ * @par Example
+ * @code{.cpp}
+ * rpp::schedulers::virtual_time scheduler{};
+ * scheduler.create_worker().schedule(std::chrono::hours{1}, [](const auto&) { std::cout << "hour passed" << std::endl; return rpp::schedulers::optional_duration{}; }, obs);
+ * scheduler.advance_by(std::chrono::hours{1}); // prints immediately
+ * @endcode
+ *
+ * @ingroup schedulers
+ */
+class virtual_time final
+{
+    struct state
+    {
+        explicit state(time_point start)
+            : now{start} {}
+
+        time_point                    now;
+        details::schedulables_queue<> queue{};
+    };
+
+public:
+    class worker_strategy
+    {
+    public:
+        explicit worker_strategy(std::shared_ptr<state> state)
+            : m_state{std::move(state)} {}
+
+        template<rpp::constraint::observer TObs, typename... Args, constraint::schedulable_fn<TObs, Args...> Fn>
+        void defer_for(duration duration, Fn&& fn, TObs&& obs, Args&&... args) const
+        {
+            if (obs.is_disposed())
+                return;
+
+            m_state->queue.emplace(m_state->now + duration, std::forward<Fn>(fn), std::forward<TObs>(obs), std::forward<Args>(args)...);
+        }
+
+        static rpp::disposable_wrapper get_disposable() { return rpp::disposable_wrapper{}; }
+
+    private:
+        std::shared_ptr<state> m_state;
+    };
+
+    explicit virtual_time(time_point start = time_point{})
+        : m_state{std::make_shared<state>(start)} {}
+
+    rpp::schedulers::worker<worker_strategy> create_worker() const
+    {
+        return rpp::schedulers::worker<worker_strategy>{m_state};
+    }
+
+    /**
+     * @brief Current time_point of virtual clock
+     */
+    time_point now() const { return m_state->now; }
+
+    /**
+     * @brief Checks if there is any pending schedulable
+     */
+    bool is_empty() const { return m_state->queue.is_empty(); }
+
+    /**
+     * @brief Moves virtual clock forward by duration executing all schedulables whose time_point is reached (including scheduled during this call)
+     */
+    void advance_by(duration duration) const { advance_to(m_state->now + duration); }
+
+    /**
+     * @brief Moves virtual clock to time_point executing all schedulables whose time_point is reached (including scheduled during this call).
+     * @details Before execution of each schedulable virtual clock is set to its time_point. Virtual clock never moves backward.
+     */
+    void advance_to(time_point timepoint) const
+    {
+        auto& s = *m_state;
+        while (!s.queue.is_empty() && s.queue.get_top_timepoint() <= timepoint)
+        {
+            auto top = s.queue.pop();
+            s.now    = std::max(s.now, top->get_timepoint());
+            if (top->is_disposed())
+                continue;
+
+            if (const auto duration = (*top)())
+                s.queue.emplace(s.now + duration.value(), std::move(top));
+        }
+        s.now = std::max(s.now, timepoint);
+    }
+
+private:
+    std::shared_ptr<state> m_state;
+};
+} // namespace rpp::schedulers
@@ -21,4 +21,5 @@
 
  #include <rpp/sources/create.hpp>
  #include <rpp/sources/from.hpp>
- #include <rpp/sources/concat.hpp>
\ No newline at end of file
+ #include <rpp/sources/concat.hpp>
+ #include <rpp/sources/range.hpp>
\ No newline at end of file
@@ -18,9 +18,75 @@
 #include <rpp/disposables/base_disposable.hpp>
 #include <rpp/memory_model.hpp>
 
+#include <cstdint>
+#include <optional>
+#include <utility>
 
 namespace rpp::details
 {
+/**
+ * @brief Active drain loop of concat. Frames of current thread are linked into stack to let inner observer detect if it completes synchronously inside of subscribe called by this loop.
+ * @details In such a case inner observer just returns ownership over container and observer to the loop and loop subscribes next observable instead of recursive subscription inside of `on_completed`.
+ * Frame is identified by address + unique id to never match another frame created at the same address later.
+ */
+class concat_drain_frame
+{
+public:
+    struct key
+    {
+        const concat_drain_frame* frame;
+        uint64_t                  id;
+    };
+
+    concat_drain_frame() noexcept
+        : m_id{++get_last_id()}
+        , m_prev{std::exchange(get_top(), this)} {}
+
+    concat_drain_frame(const concat_drain_frame&) = delete;
+    concat_drain_frame(concat_drain_frame&&)      = delete;
+
+    ~concat_drain_frame() noexcept { get_top() = m_prev; }
+
+    key get_key() const noexcept { return {this, m_id}; }
+
+    /**
+     * @brief Returns frame with provided key if it is still active on current thread
+     */
+    static concat_drain_frame* find_active(const key& k) noexcept
+    {
+        for (auto* frame = get_top(); frame; frame = frame->m_prev)
+        {
+            if (frame == k.frame)
+                return frame->m_id == k.id ? frame : nullptr;
+        }
+        return nullptr;
+    }
+
+private:
+    static concat_drain_frame*& get_top() noexcept
+    {
+        static thread_local concat_drain_frame* s_top{};
+        return s_top;
+    }
+
+    static uint64_t& get_last_id() noexcept
+    {
+        static thread_local uint64_t s_last_id{};
+        return s_last_id;
+    }
+
+private:
+    uint64_t            m_id;
+    concat_drain_frame* m_prev;
+};
+
+template<constraint::decayed_type PackedContainer, rpp::constraint::observer TObserver>
+struct concat_drain_state final : concat_drain_frame
+{
+    std::optional<PackedContainer> container{};
+    std::optional<TObserver>       observer{};
+};
+
 template<constraint::memory_model memory_model, rpp::constraint::observable TObservable, rpp::constraint::observable ...TObservables>
 auto pack_observables(TObservable&& obs, TObservables&&...others)
 {
@@ -43,15 +109,27 @@ struct concat_source_observer_strategy
     using Type = utils::extract_observable_type_t<utils::iterable_value_t<PackedContainer>>;
 
     RPP_NO_UNIQUE_ADDRESS mutable PackedContainer container;
+    concat_drain_frame::key                       drain_frame;
 
     constexpr static operators::details::forwarding_on_next_strategy on_next{};
     constexpr static operators::details::forwarding_on_error_strategy on_error{};
     constexpr static operators::details::forwarding_set_upstream_strategy set_upstream{};
     constexpr static operators::details::forwarding_is_disposed_strategy is_disposed{};
 
-    void on_completed(rpp::constraint::observer auto& observer) const
+    template<rpp::constraint::observer TObserver>
+    void on_completed(TObserver& observer) const
     {
         container.increment_iterator();
+
+        // completed synchronously inside of drain loop -> let loop subscribe next one to keep stack constant
+        if (auto* frame = concat_drain_frame::find_active(drain_frame))
+        {
+            auto& state = static_cast<concat_drain_state<PackedContainer, TObserver>&>(*frame);
+            state.container.emplace(std::move(container));
+            state.observer.emplace(std::move(observer));
+            return;
+        }
+
         concat_strategy<PackedContainer>::drain(std::move(container), std::move(observer));
     }
 };
@@ -71,6 +149,24 @@ struct concat_strategy
 
     template<constraint::observer_strategy<Type> Strategy>
     static void drain(constraint::decayed_same_as<PackedContainer> auto&& container, base_observer<Type, Strategy>&& observer)
+    {
+        concat_drain_state<PackedContainer, base_observer<Type, Strategy>> state{};
+
+        subscribe_next(std::forward<decltype(container)>(container), std::move(observer), state);
+        while (state.observer)
+        {
+            auto next_observer  = std::move(state.observer).value();
+            auto next_container = std::move(state.container).value();
+            state.observer.reset();
+            state.container.reset();
+
+            subscribe_next(std::move(next_container), std::move(next_observer), state);
+        }
+    }
+
+private:
+    template<constraint::observer_strategy<Type> Strategy>
+    static void subscribe_next(constraint::decayed_same_as<PackedContainer> auto&& container, base_observer<Type, Strategy>&& observer, const concat_drain_frame& frame)
     {
         if (const auto itr = container.get_actual_iterator(); itr != std::cend(container))
         {
@@ -80,7 +176,8 @@ struct concat_strategy
                                                concat_source_observer_strategy<PackedContainer>>>
                                                {
                                                    std::move(observer),
-                                                   std::forward<decltype(container)>(container)
+                                                   std::forward<decltype(container)>(container),
+                                                   frame.get_key()
                                                });
         }
         else
@@ -10,15 +10,23 @@
 #pragma once
 
 #include <rpp/defs.hpp>
+#include <rpp/memory_model.hpp>
 #include <rpp/sources/fwd.hpp>
 #include <rpp/observables/base_observable.hpp>
 #include <rpp/utils/utils.hpp>
 #include <rpp/schedulers/current_thread.hpp>
 #include <rpp/operators/map.hpp>
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
 #include <exception>
+#include <iterator>
 #include <memory>
+#include <memory_resource>
+#include <ranges>
+#include <span>
+#include <type_traits>
 #include <utility>
 
 namespace rpp::details
@@ -36,6 +44,29 @@ public:
     shared_container(const shared_container&) = default;
     shared_container(shared_container&&) noexcept = default;
 
+    /**
+     * @brief Creates shared_container with container and control block allocated from provided memory resource
+     */
+    template<typename ...Ts>
+    static shared_container make_in_arena(std::pmr::memory_resource& resource, Ts&&...items)
+    {
+        std::pmr::polymorphic_allocator<Container> allocator{&resource};
+
+        Container* container = allocator.allocate(1);
+        RPP_TRY
+        {
+            // placement "new" with braces to keep same initialization as for regular shared_container
+            ::new (container) Container{std::forward<Ts>(items)...};
+        }
+        RPP_CATCH(...)
+        {
+            allocator.deallocate(container, 1);
+            std::rethrow_exception(std::current_exception());
+        }
+        // deleter is invoked by shared_ptr itself in case of failed allocation of control block
+        return shared_container{arena_tag{}, std::shared_ptr<Container>{container, arena_deleter{&resource}, allocator}};
+    }
+
     auto begin() const { return std::cbegin(*m_container); }
     auto end() const { return std::cend(*m_container); }
 
@@ -57,32 +88,63 @@ public:
         return *itr;
     }
 
+private:
+    struct arena_tag {};
+
+    struct arena_deleter
+    {
+        std::pmr::memory_resource* resource;
+
+        void operator()(Container* container) const noexcept
+        {
+            std::destroy_at(container);
+            std::pmr::polymorphic_allocator<Container>{resource}.deallocate(container, 1);
+        }
+    };
+
+    shared_container(arena_tag, std::shared_ptr<Container>&& container)
+        : m_container{std::move(container)} {}
+
 private:
     std::shared_ptr<Container>                                 m_container{};
     mutable std::optional<decltype(std::cbegin(*m_container))> m_iterator;
 };
 
+/**
+ * @brief Container with position of current iteration used by rpp::memory_model::use_stack.
+ * @details Resuming of iteration after moving is O(1) for any kind of container:
+ * - container with random-access iterators is kept in place and iterator is re-positioned by index after copy/move.
+ * - any other container (list, map, set, input-only ranges) is kept on heap, so its address is stable and moving just transfers iterator together with container.
+ *
+ * Copying always re-positions iterator by index, but it is proportional to copying of container itself.
+ */
 template<constraint::decayed_type Container>
 class container_with_iterator
 {
+    static constexpr bool s_is_inplace = std::random_access_iterator<decltype(std::cbegin(std::declval<const Container&>()))>;
+
+    using storage = std::conditional_t<s_is_inplace, Container, std::unique_ptr<Container>>;
+
 public:
     template<typename ...Ts>
         requires (!constraint::variadic_decayed_same_as<container_with_iterator<Container>, Ts...>)
     explicit container_with_iterator(Ts&&...items)
-        : m_container{std::forward<Ts>(items)...} {}
+        : m_container{make_storage(std::forward<Ts>(items)...)} {}
 
     container_with_iterator(const container_with_iterator& other)
-        : m_container{other.m_container}
+        : m_container{copy_storage(other.m_container)}
         , m_index(other.m_index)
     {}
 
     container_with_iterator(container_with_iterator&& other) noexcept
         : m_container{std::move(other.m_container)}
         , m_index(other.m_index)
+        // iterator refers to the same heap container, so it is still valid
+        , m_iterator{s_is_inplace ? std::nullopt : std::move(other.m_iterator)}
     {}
 
-    auto begin() const { return std::cbegin(m_container); }
-    auto end() const { return std::cend(m_container); }
+    auto begin() const { return std::cbegin(get_container()); }
+    auto end() const { return std::cend(get_container()); }
 
     auto get_actual_iterator() const
     {
@@ -104,6 +166,32 @@ public:
     }
 
 private:
+    template<typename ...Ts>
+    static storage make_storage(Ts&&...items)
+    {
+        if constexpr (s_is_inplace)
+            return storage{std::forward<Ts>(items)...};
+        else
+            // raw "new" call to keep same initialization as for in-place container
+            return storage{new Container{std::forward<Ts>(items)...}};
+    }
+
+    static storage copy_storage(const storage& other)
+    {
+        if constexpr (s_is_inplace)
+            return other;
+        else
+            return std::make_unique<Container>(*other);
+    }
+
+    const Container& get_container() const
+    {
+        if constexpr (s_is_inplace)
+            return m_container;
+        else
+            return *m_container;
+    }
+
     auto get_default_iterator_value() const
     {
         auto itr = begin();
@@ -112,9 +200,9 @@ private:
     }
 
 private:
-    RPP_NO_UNIQUE_ADDRESS Container                           m_container{};
-    mutable size_t                                            m_index{};
-    mutable std::optional<decltype(std::cbegin(m_container))> m_iterator{};
+    RPP_NO_UNIQUE_ADDRESS storage                                        m_container{};
+    mutable size_t                                                       m_index{};
+    mutable std::optional<decltype(std::cbegin(std::declval<const Container&>()))> m_iterator{};
 };
 
 template<constraint::memory_model memory_model, constraint::iterable Container, typename ...Ts>
@@ -122,6 +210,11 @@ auto pack_to_container(Ts&& ...items)
 {
     if constexpr (std::same_as<memory_model, rpp::memory_model::use_stack>)
         return container_with_iterator<Container>{std::forward<Ts>(items)...};
+    else if constexpr (std::same_as<memory_model, rpp::memory_model::use_arena>)
+    {
+        auto* resource = rpp::memory_model::arena_scope::get_resource();
+        return shared_container<Container>::make_in_arena(resource ? *resource : *std::pmr::get_default_resource(), std::forward<Ts>(items)...);
+    }
     else
         return shared_container<Container>{std::forward<Ts>(items)...};
 }
@@ -135,27 +228,38 @@ auto pack_variadic(Ts&& ...items)
 template<constraint::decayed_type PackedContainer, schedulers::constraint::scheduler TScheduler>
 struct from_iterable_strategy
 {
+    using Type = utils::iterable_value_t<PackedContainer>;
+
     RPP_NO_UNIQUE_ADDRESS PackedContainer container;
     RPP_NO_UNIQUE_ADDRESS TScheduler      scheduler;
+    size_t                                emission_quantum{default_emission_quantum};
 
-    template<constraint::observer_strategy<utils::iterable_value_t<PackedContainer>> Strategy>
-    void subscribe(base_observer<utils::iterable_value_t<PackedContainer>, Strategy>&& observer) const
+    template<constraint::observer_strategy<Type> Strategy>
+    void subscribe(base_observer<Type, Strategy>&& observer) const
     {
         if constexpr (std::same_as<TScheduler, schedulers::immediate>)
         {
-            try
+            RPP_TRY
             {
-                for (const auto& v : container)
+                if constexpr (is_contiguous)
                 {
-                    if (observer.is_disposed())
-                        return;
+                    // contiguous values are passed as one batch to let operators process them together
+                    observer.on_next_batch(std::span<const Type>{std::cbegin(container), std::cend(container)});
+                }
+                else
+                {
+                    for (const auto& v : container)
+                    {
+                        if (observer.is_disposed())
+                            return;
 
-                    observer.on_next(v);
+                        observer.on_next(v);
+                    }
                 }
 
                 observer.on_completed();
             }
-            catch (...)
+            RPP_CATCH(...)
             {
                 observer.on_error(std::current_exception());
             }
@@ -164,20 +268,17 @@ struct from_iterable_strategy
         {
             const auto worker = scheduler.create_worker();
             observer.set_upstream(worker.get_disposable());
-            worker.schedule([](const base_observer<utils::iterable_value_t<PackedContainer>, Strategy>& obs, const PackedContainer& cont) -> rpp::schedulers::optional_duration
+            worker.schedule([quantum = std::max(emission_quantum, size_t{1})](const base_observer<Type, Strategy>& obs, const PackedContainer& cont) -> rpp::schedulers::optional_duration
             {
-                try
+                RPP_TRY
                 {
-                    if (const auto itr = cont.get_actual_iterator(); itr != std::cend(cont))
-                    {
-                        obs.on_next(utils::as_const(*itr));
-                        if (cont.increment_iterator()) // it was not last
-                            return schedulers::duration{}; // re-schedule this
-                    }
+                    if (emit_quantum(obs, cont, quantum))
+                        return schedulers::duration{}; // re-schedule this to emit next quantum
 
-                    obs.on_completed();
+                    if (!obs.is_disposed())
+                        obs.on_completed();
                 }
-                catch(...)
+                RPP_CATCH(...)
                 {
                     obs.on_error(std::current_exception());
                 }
@@ -185,15 +286,190 @@ struct from_iterable_strategy
             }, std::move(observer), container);
         }
     }
+
+private:
+    static constexpr bool is_contiguous = std::contiguous_iterator<decltype(std::cbegin(std::declval<const PackedContainer&>()))>;
+
+    // emits up to `quantum` values and returns true if there are values to emit left
+    template<constraint::observer_strategy<Type> Strategy>
+    static bool emit_quantum(const base_observer<Type, Strategy>& obs, const PackedContainer& cont, size_t quantum)
+    {
+        auto itr = cont.get_actual_iterator();
+        if (itr == std::cend(cont))
+            return false;
+
+        if constexpr (is_contiguous)
+        {
+            const auto count = std::min(quantum, static_cast<size_t>(std::distance(itr, std::cend(cont))));
+            obs.on_next_batch(std::span<const Type>{itr, count});
+
+            bool has_more{};
+            for (size_t i = 0; i < count; ++i)
+                has_more = cont.increment_iterator();
+            return has_more && !obs.is_disposed();
+        }
+        else
+        {
+            for (size_t i = 0; i < quantum; ++i)
+            {
+                obs.on_next(utils::as_const(*itr));
+                if (!cont.increment_iterator()) // it was last
+                    return false;
+                if (obs.is_disposed())
+                    return false;
+                itr = cont.get_actual_iterator();
+            }
+            return true;
+        }
+    }
 };
 
 template<typename PackedContainer, schedulers::constraint::scheduler TScheduler>
-auto make_from_iterable_observable(PackedContainer&& container, const TScheduler& scheduler)
+auto make_from_iterable_observable(PackedContainer&& container, const TScheduler& scheduler, size_t emission_quantum = default_emission_quantum)
 {
     return base_observable<utils::iterable_value_t<std::decay_t<PackedContainer>>,
                            details::from_iterable_strategy<std::decay_t<PackedContainer>, TScheduler>>{std::forward<PackedContainer>(container),
-                                                                                                       scheduler};
+                                                                                                       scheduler,
+                                                                                                       emission_quantum};
 }
+
+template<std::ranges::view View>
+    requires std::ranges::input_range<View> && std::copyable<View>
+class from_range_strategy
+{
+public:
+    using Type = std::ranges::range_value_t<View>;
+
+    from_range_strategy(View view, size_t emission_quantum)
+        : m_view{std::move(view)}
+        , m_emission_quantum{std::max(emission_quantum, size_t{1})} {}
+
+    template<constraint::observer_strategy<Type> Strategy, schedulers::constraint::scheduler TScheduler>
+    void subscribe(base_observer<Type, Strategy>&& observer, const TScheduler& scheduler) const
+    {
+        if constexpr (std::same_as<TScheduler, schedulers::immediate>)
+        {
+            RPP_TRY
+            {
+                // view could be not const-iterable (like filter_view caching its begin), so each subscription iterates own copy
+                auto view = m_view;
+                if constexpr (is_contiguous)
+                {
+                    observer.on_next_batch(std::span<const Type>{std::ranges::data(view), static_cast<size_t>(std::ranges::size(view))});
+                }
+                else
+                {
+                    for (auto itr = std::ranges::begin(view); itr != std::ranges::end(view); ++itr)
+                    {
+                        if (observer.is_disposed())
+                            return;
+
+                        emit(observer, itr);
+                    }
+                }
+
+                observer.on_completed();
+            }
+            RPP_CATCH(...)
+            {
+                observer.on_error(std::current_exception());
+            }
+        }
+        else
+        {
+            const auto worker = scheduler.create_worker();
+            observer.set_upstream(worker.get_disposable());
+            // iterators of some views refer to view itself, so view and iterator are kept together in place instead of re-positioning of iterator after moving
+            worker.schedule([](const base_observer<Type, Strategy>& obs, const std::shared_ptr<iteration_state>& state) -> rpp::schedulers::optional_duration
+            {
+                RPP_TRY
+                {
+                    if (emit_quantum(obs, *state))
+                        return schedulers::duration{}; // re-schedule this to emit next quantum
+
+                    if (!obs.is_disposed())
+                        obs.on_completed();
+                }
+                RPP_CATCH(...)
+                {
+                    obs.on_error(std::current_exception());
+                }
+                return std::nullopt;
+            }, std::move(observer), std::make_shared<iteration_state>(m_view, m_emission_quantum));
+        }
+    }
+
+private:
+    static constexpr bool is_contiguous = std::ranges::contiguous_range<View> && std::ranges::sized_range<View>;
+
+    struct iteration_state
+    {
+        iteration_state(const View& v, size_t emission_quantum)
+            : view{v}
+            , itr{std::ranges::begin(view)}
+            , quantum{emission_quantum} {}
+
+        iteration_state(const iteration_state&) = delete;
+        iteration_state(iteration_state&&)      = delete;
+
+        View                           view;
+        std::ranges::iterator_t<View>  itr;
+        size_t                         quantum;
+    };
+
+    template<constraint::observer_strategy<Type> Strategy>
+    static void emit(const base_observer<Type, Strategy>& obs, const std::ranges::iterator_t<View>& itr)
+    {
+        if constexpr (std::is_lvalue_reference_v<std::ranges::range_reference_t<View>>)
+            obs.on_next(utils::as_const(*itr));
+        else
+            obs.on_next(Type(*itr));
+    }
+
+    // emits up to quantum values and returns true if there are values to emit left
+    template<constraint::observer_strategy<Type> Strategy>
+    static bool emit_quantum(const base_observer<Type, Strategy>& obs, iteration_state& state)
+    {
+        const auto end = std::ranges::end(state.view);
+        if constexpr (is_contiguous)
+        {
+            const auto count = std::min(state.quantum, static_cast<size_t>(end - state.itr));
+            if (count != 0)
+                obs.on_next_batch(std::span<const Type>{std::to_address(state.itr), count});
+            state.itr += static_cast<std::ranges::range_difference_t<View>>(count);
+        }
+        else
+        {
+            for (size_t i = 0; i < state.quantum && state.itr != end; ++i, ++state.itr)
+            {
+                if (obs.is_disposed())
+                    return false;
+
+                emit(obs, state.itr);
+            }
+        }
+        return state.itr != end && !obs.is_disposed();
+    }
+
+private:
+    View   m_view;
+    size_t m_emission_quantum;
+};
+
+template<std::ranges::view View, schedulers::constraint::scheduler TScheduler>
+struct from_range_with_scheduler_strategy
+{
+    using Type = typename from_range_strategy<View>::Type;
+
+    RPP_NO_UNIQUE_ADDRESS from_range_strategy<View> strategy;
+    RPP_NO_UNIQUE_ADDRESS TScheduler                scheduler;
+
+    template<constraint::observer_strategy<Type> Strategy>
+    void subscribe(base_observer<Type, Strategy>&& observer) const
+    {
+        strategy.subscribe(std::move(observer), scheduler);
+    }
+};
 } // namespace rpp::details
 
 namespace rpp::source
@@ -209,6 +485,8 @@ namespace rpp::source
  * @tparam memory_model rpp::memory_model strategy used to handle provided iterable
  * @param scheduler is scheduler used for scheduling of submissions: next item will be submitted to scheduler when previous one is executed
  * @param iterable container with values which will be flattened
+ * @param emission_quantum max amount of values emitted per one execution of schedulable: scheduled action emits up to this amount of values and then yields to scheduler (so, other queued actions are not starved).
+ * Contiguous values are emitted as one batch. Ignored for rpp::schedulers::immediate.
  *
  * @par Examples:
  * @snippet from.cpp from_iterable
@@ -219,9 +497,41 @@ namespace rpp::source
  * @see https://reactivex.io/documentation/operators/from.html
  */
 template<constraint::memory_model memory_model/* = memory_model::use_stack*/, constraint::iterable Iterable, schedulers::constraint::scheduler TScheduler /* = schedulers::current_thread*/>
-auto from_iterable(Iterable&& iterable, const TScheduler& scheduler /* = TScheduler{}*/)
+auto from_iterable(Iterable&& iterable, const TScheduler& scheduler /* = TScheduler{}*/, size_t emission_quantum /* = details::default_emission_quantum*/)
+{
+    return details::make_from_iterable_observable(details::pack_to_container<memory_model, std::decay_t<Iterable>>(std::forward<Iterable>(iterable)), scheduler, emission_quantum);
+}
+
+/**
+ * @brief Creates observable that lazily emits values of provided range (std::ranges view like iota, transform, filter and etc) without materializing it into container
+ *
+ * @marble from_range
+   {
+       operator "from_range(std::views::iota(1, 4))": +-1-2-3-|
+   }
+ *
+ * @details Range is wrapped via `std::views::all`, so lvalue container is referenced (not copied!) and should outlive observable. Each subscription iterates own copy of the view,
+ * so view should be copyable (use rpp::source::from_iterable for rvalue containers).
+ * In case of non-immediate scheduler view and its iterator are kept together in place for the whole subscription, so resuming of iteration is O(1) for any kind of view.
+ *
+ * @param range viewable range with values to emit
+ * @param scheduler is scheduler used for scheduling of submissions
+ * @param emission_quantum max amount of values emitted per one execution of schedulable before yielding to scheduler. Ignored for rpp::schedulers::immediate.
+ *
+ * @par Examples:
+ * @snippet from.cpp from_range
+ *
+ * @ingroup creational_operators
+ * @see https://reactivex.io/documentation/operators/from.html
+ */
+template<std::ranges::viewable_range Range, schedulers::constraint::scheduler TScheduler /* = schedulers::current_thread*/>
+    requires std::ranges::input_range<std::views::all_t<Range>> && std::copyable<std::views::all_t<Range>>
+auto from_range(Range&& range, const TScheduler& scheduler /* = TScheduler{}*/, size_t emission_quantum /* = details::default_emission_quantum*/)
 {
-    return details::make_from_iterable_observable(details::pack_to_container<memory_model, std::decay_t<Iterable>>(std::forward<Iterable>(iterable)), scheduler);
+    using view = std::views::all_t<Range>;
+    return base_observable<typename details::from_range_strategy<view>::Type,
+                           details::from_range_with_scheduler_strategy<view, TScheduler>>{details::from_range_strategy<view>{std::views::all(std::forward<Range>(range)), emission_quantum},
+                                                                                         scheduler};
 }
 
 /**
@@ -18,6 +18,10 @@
 #include <rpp/utils/function_traits.hpp>
 #include <rpp/memory_model.hpp>
 
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+
 namespace rpp::constraint
 {
 template<typename S, typename T>
@@ -27,6 +31,12 @@ concept on_subscribe = requires(const S& strategy, dynamic_observer<T>&& observe
 };
 }
 
+namespace rpp::details
+{
+// default amount of values emitted by from_iterable per one execution of schedulable before yielding to scheduler
+inline constexpr size_t default_emission_quantum = 64;
+} // namespace rpp::details
+
 namespace rpp::source
 {
 template<constraint::decayed_type Type, constraint::on_subscribe<Type> OnSubscribe>
@@ -36,7 +46,11 @@ template<utils::is_not_template_callable OnSubscribe, constraint::decayed_type T
 auto create(OnSubscribe&& on_subscribe);
 
 template<constraint::memory_model memory_model= memory_model::use_stack, constraint::iterable Iterable, schedulers::constraint::scheduler TScheduler = schedulers::current_thread>
-auto from_iterable(Iterable&& iterable, const TScheduler& scheduler = TScheduler{});
+auto from_iterable(Iterable&& iterable, const TScheduler& scheduler = TScheduler{}, size_t emission_quantum = details::default_emission_quantum);
+
+template<std::ranges::viewable_range Range, schedulers::constraint::scheduler TScheduler = schedulers::current_thread>
+    requires std::ranges::input_range<std::views::all_t<Range>> && std::copyable<std::views::all_t<Range>>
+auto from_range(Range&& range, const TScheduler& scheduler = TScheduler{}, size_t emission_quantum = details::default_emission_quantum);
 
 template<constraint::memory_model memory_model = memory_model::use_stack, typename T, typename ...Ts>
 auto just(T&& item, Ts&& ...items) requires (constraint::decayed_same_as<T, Ts> && ...);
@@ -44,6 +58,9 @@ auto just(T&& item, Ts&& ...items) requires (constraint::decayed_same_as<T, Ts>
 template<constraint::memory_model memory_model = memory_model::use_stack, schedulers::constraint::scheduler TScheduler, typename T, typename ...Ts>
 auto just(const TScheduler& scheduler, T&& item, Ts&& ...items) requires (constraint::decayed_same_as<T, Ts> && ...);
 
+template<std::integral Type, schedulers::constraint::scheduler TScheduler = schedulers::current_thread>
+auto range(Type first, size_t count, const TScheduler& scheduler = TScheduler{}, size_t emission_quantum = details::default_emission_quantum);
+
 template<constraint::memory_model memory_model = memory_model::use_stack, std::invocable<> Callable>
 auto from_callable(Callable&& callable);
 
@@ -0,0 +1,145 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/defs.hpp>
+#include <rpp/sources/fwd.hpp>
+#include <rpp/observables/base_observable.hpp>
+#include <rpp/operators/details/strategy.hpp>
+#include <rpp/schedulers/current_thread.hpp>
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <span>
+
+namespace rpp::details
+{
+template<std::integral Type, schedulers::constraint::scheduler TScheduler>
+struct range_strategy
+{
+    Type                             first;
+    size_t                           count;
+    RPP_NO_UNIQUE_ADDRESS TScheduler scheduler;
+    size_t                           emission_quantum{default_emission_quantum};
+
+    template<constraint::observer_strategy<Type> Strategy>
+    void subscribe(base_observer<Type, Strategy>&& observer) const
+    {
+        if constexpr (std::same_as<TScheduler, schedulers::immediate>)
+        {
+            RPP_TRY
+            {
+                size_t emitted{};
+                if (emit(observer, first, emitted, count))
+                    observer.on_completed();
+            }
+            RPP_CATCH(...)
+            {
+                observer.on_error(std::current_exception());
+            }
+        }
+        else
+        {
+            const auto worker = scheduler.create_worker();
+            observer.set_upstream(worker.get_disposable());
+            worker.schedule([first = first, count = count, quantum = std::max(emission_quantum, size_t{1})](const base_observer<Type, Strategy>& obs, size_t& emitted) -> rpp::schedulers::optional_duration
+            {
+                RPP_TRY
+                {
+                    if (!emit(obs, first, emitted, std::min(count, emitted + quantum)))
+                        return std::nullopt;
+
+                    if (emitted != count)
+                        return schedulers::duration{}; // re-schedule this to emit next quantum
+
+                    obs.on_completed();
+                }
+                RPP_CATCH(...)
+                {
+                    obs.on_error(std::current_exception());
+                }
+                return std::nullopt;
+            }, std::move(observer), size_t{});
+        }
+    }
+
+private:
+    static Type value_at(Type first, size_t offset) { return static_cast<Type>(first + static_cast<Type>(offset)); }
+
+    // emits values with offsets [emitted, till) and returns false if observer is disposed
+    template<constraint::observer_strategy<Type> Strategy>
+    static bool emit(const base_observer<Type, Strategy>& obs, Type first, size_t& emitted, size_t till)
+    {
+        if constexpr (operators::details::batch_native_observer<base_observer<Type, Strategy>>)
+        {
+            // values are generated by chunks into local buffer: such a loop is easily vectorized and chunk is passed downstream as one batch
+            std::array<Type, operators::details::batch_chunk_size> buffer;
+            while (emitted != till)
+            {
+                // downstream could stop after some value, so values after it are not generated and not passed to operators computing batch ahead
+                const auto chunk_size = std::min({buffer.size(), till - emitted, operators::details::get_batch_demand(obs)});
+                for (size_t i = 0; i < chunk_size; ++i)
+                    buffer[i] = value_at(first, emitted + i);
+
+                obs.on_next_batch(std::span<const Type>{buffer.data(), chunk_size});
+                emitted += chunk_size;
+                if (obs.is_disposed())
+                    return false;
+            }
+        }
+        else
+        {
+            for (; emitted != till; ++emitted)
+            {
+                if (obs.is_disposed())
+                    return false;
+
+                obs.on_next(value_at(first, emitted));
+            }
+        }
+        return !obs.is_disposed();
+    }
+};
+} // namespace rpp::details
+
+namespace rpp::source
+{
+/**
+ * @brief Creates observable that emits `count` sequential integers starting from `first` and completes
+ *
+ * @marble range
+   {
+       operator "range(1, 4)": +-1-2-3-4-|
+   }
+ *
+ * @details Values are generated on the fly without allocation of the whole sequence. In case of downstream supports batches, values are generated and passed by contiguous chunks,
+ * so arithmetic map/filter stages can process them together.
+ *
+ * @param first first value to emit
+ * @param count amount of values to emit
+ * @param scheduler is scheduler used for scheduling of submissions
+ * @param emission_quantum max amount of values emitted per one execution of schedulable before yielding to scheduler. Ignored for rpp::schedulers::immediate.
+ *
+ * @par Examples:
+ * @snippet range.cpp range
+ *
+ * @ingroup creational_operators
+ * @see https://reactivex.io/documentation/operators/range.html
+ */
+template<std::integral Type, schedulers::constraint::scheduler TScheduler /* = schedulers::current_thread*/>
+auto range(Type first, size_t count, const TScheduler& scheduler /* = TScheduler{}*/, size_t emission_quantum /* = details::default_emission_quantum*/)
+{
+    return base_observable<Type, details::range_strategy<Type, TScheduler>>{first, count, scheduler, emission_quantum};
+}
+} // namespace rpp::source
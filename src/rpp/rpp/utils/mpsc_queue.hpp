@@ -0,0 +1,157 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <atomic>
+#include <concepts>
+#include <utility>
+
+namespace rpp::details
+{
+/**
+ * @brief Intrusive link used by rpp::details::intrusive_mpsc_queue.
+ */
+struct mpsc_node
+{
+    std::atomic<mpsc_node*> mpsc_next{};
+};
+
+/**
+ * @brief Intrusive lock-free multi-producer single-consumer queue (Dmitry Vyukov's algorithm). Used by both schedulers and operators.
+ * @details `push` is wait-free: it is one atomic exchange plus one store, so producers never wait for each other or for consumer.
+ * Nodes are linked via their own rpp::details::mpsc_node, so queue doesn't allocate and doesn't own nodes: owner has to pop all of them before destruction.
+ *
+ * Consumer can observe queue in the intermediate state when producer already exchanged head, but not linked its node yet: `pop` returns nothing
+ * while `is_empty` returns false till producer finishes its push.
+ *
+ * @warning `pop` and `is_empty` have to be called by one consumer at a time.
+ */
+template<std::derived_from<mpsc_node> Node>
+class intrusive_mpsc_queue
+{
+public:
+    intrusive_mpsc_queue() = default;
+
+    intrusive_mpsc_queue(const intrusive_mpsc_queue&) = delete;
+    intrusive_mpsc_queue(intrusive_mpsc_queue&&)      = delete;
+
+    void push(Node* node) { push_node(node); }
+
+    Node* pop()
+    {
+        mpsc_node* tail = m_tail;
+        mpsc_node* next = tail->mpsc_next.load(std::memory_order_acquire);
+        if (tail == &m_stub)
+        {
+            if (!next)
+                return nullptr;
+
+            m_tail = next;
+            tail   = next;
+            next   = next->mpsc_next.load(std::memory_order_acquire);
+        }
+
+        if (!next)
+        {
+            // some producer is in the middle of push
+            if (tail != m_head.load(std::memory_order_acquire))
+                return nullptr;
+
+            // stub is pushed back to keep queue non-empty while the last node is being taken
+            push_node(&m_stub);
+            next = tail->mpsc_next.load(std::memory_order_acquire);
+            if (!next)
+                return nullptr;
+        }
+
+        m_tail = next;
+        return static_cast<Node*>(tail);
+    }
+
+    /**
+     * @brief Checks if there is no any pushed or being pushed node. Sequentially consistent with `push` to let consumer safely decide to sleep.
+     */
+    bool is_empty() const { return m_tail == &m_stub && m_head.load(std::memory_order_seq_cst) == &m_stub; }
+
+private:
+    void push_node(mpsc_node* node)
+    {
+        node->mpsc_next.store(nullptr, std::memory_order_relaxed);
+        mpsc_node* prev = m_head.exchange(node, std::memory_order_seq_cst);
+        prev->mpsc_next.store(node, std::memory_order_release);
+    }
+
+private:
+    mpsc_node               m_stub{};
+    std::atomic<mpsc_node*> m_head{&m_stub};
+    mpsc_node*              m_tail{&m_stub};
+};
+
+/**
+ * @brief Lock-free multi-producer single-consumer queue of values: rpp::details::intrusive_mpsc_queue of nodes allocated per value.
+ * @details Expected to be used only on contended path (see rpp::operators::details::serialized_emitter), as each value takes one allocation.
+ *
+ * @warning `pop_to` has to be called by one consumer at a time.
+ */
+template<typename T>
+class mpsc_queue
+{
+    struct node final : mpsc_node
+    {
+        template<typename... Args>
+        explicit node(Args&&... args)
+            : value(std::forward<Args>(args)...)
+        {
+        }
+
+        T value;
+    };
+
+public:
+    mpsc_queue() = default;
+
+    mpsc_queue(const mpsc_queue&) = delete;
+    mpsc_queue(mpsc_queue&&)      = delete;
+
+    ~mpsc_queue() noexcept
+    {
+        while (auto* n = m_queue.pop())
+            delete n;
+    }
+
+    template<typename... Args>
+    void emplace(Args&&... args)
+    {
+        m_queue.push(new node(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Passes the oldest value to `fn` as rvalue. Value is moved out of node and node is freed before invoking of `fn`.
+     * Returns false if there is no value available right now.
+     */
+    template<typename Fn>
+    bool pop_to(Fn&& fn)
+    {
+        auto* n = m_queue.pop();
+        if (!n)
+            return false;
+
+        T value{std::move(n->value)};
+        delete n;
+
+        std::forward<Fn>(fn)(std::move(value));
+        return true;
+    }
+
+private:
+    intrusive_mpsc_queue<node> m_queue{};
+};
+} // namespace rpp::details
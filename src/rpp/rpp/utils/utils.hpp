@@ -13,7 +13,9 @@
 #include <rpp/defs.hpp>
 #include <rpp/utils/constraints.hpp>
 
+#include <compare>
 #include <concepts>
+#include <cstddef>
 #include <iterator>
 
 namespace rpp::utils {
@@ -67,23 +69,38 @@ public:
     class iterator
     {
     public:
+        iterator() = default;
         iterator(const repeated_container* container, size_t index) : m_container{container}, m_index{index} {}
 
-        using iterator_category = std::input_iterator_tag;
+        // random access to make re-positioning of iterator (e.g. by container_with_iterator) O(1)
+        using iterator_category = std::random_access_iterator_tag;
         using difference_type   = std::ptrdiff_t;
         using value_type        = T;
-        using pointer           = T*;
+        using pointer           = const T*;
+        using reference         = const T&;
+
+        reference operator*() const { return m_container->m_value; }
+        reference operator[](difference_type) const { return m_container->m_value; }
 
-        const value_type& operator*() const { return m_container->m_value; }
         iterator& operator++() { ++m_index; return *this; }
         iterator operator++(int) { auto old = *this; ++(*this); return old; }
+        iterator& operator--() { --m_index; return *this; }
+        iterator operator--(int) { auto old = *this; --(*this); return old; }
 
-        bool operator==(const iterator&) const = default;
-        bool operator!=(const iterator&) const = default;
+        iterator& operator+=(difference_type n) { m_index = static_cast<size_t>(static_cast<difference_type>(m_index) + n); return *this; }
+        iterator& operator-=(difference_type n) { return *this += -n; }
+
+        friend iterator operator+(iterator itr, difference_type n) { return itr += n; }
+        friend iterator operator+(difference_type n, iterator itr) { return itr += n; }
+        friend iterator operator-(iterator itr, difference_type n) { return itr -= n; }
+        friend difference_type operator-(const iterator& lhs, const iterator& rhs) { return static_cast<difference_type>(lhs.m_index) - static_cast<difference_type>(rhs.m_index); }
+
+        bool operator==(const iterator& other) const { return m_index == other.m_index && m_container == other.m_container; }
+        auto operator<=>(const iterator& other) const { return m_index <=> other.m_index; }
 
     private:
-        const repeated_container* m_container;
-        size_t m_index;
+        const repeated_container* m_container{};
+        size_t m_index{};
     };
 
     iterator begin() const { return {this, 0}; }
@@ -9,6 +9,7 @@
 //
 
 #include <snitch/snitch.hpp>
+#include <rpp/schedulers/immediate.hpp>
 #include <rpp/sources/just.hpp>
 #include <rpp/sources/concat.hpp>
 #include <rpp/sources/create.hpp>
@@ -19,10 +20,41 @@
 #include "rpp/disposables/base_disposable.hpp"
 #include "rpp/disposables/disposable_wrapper.hpp"
 
+#include <cstddef>
+#include <iterator>
+#include <list>
 #include <memory>
 #include <optional>
 
-TEMPLATE_TEST_CASE("concat as source", "", rpp::memory_model::use_stack, rpp::memory_model::use_shared)
+template<typename T>
+struct increments_counting_list
+{
+    struct iterator
+    {
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = T;
+        using pointer           = const T*;
+        using reference         = const T&;
+
+        reference operator*() const { return *itr; }
+        iterator& operator++() { ++(*increments); ++itr; return *this; }
+        iterator operator++(int) { auto old = *this; ++(*this); return old; }
+
+        bool operator==(const iterator& other) const { return itr == other.itr; }
+
+        typename std::list<T>::const_iterator itr{};
+        size_t*                               increments{};
+    };
+
+    iterator begin() const { return {values.cbegin(), increments}; }
+    iterator end() const { return {values.cend(), increments}; }
+
+    std::list<T> values{};
+    size_t*      increments{};
+};
+
+TEMPLATE_TEST_CASE("concat as source", "", rpp::memory_model::use_stack, rpp::memory_model::use_shared, rpp::memory_model::use_arena)
 {
     mock_observer_strategy<int> mock{};
     SECTION("concat of solo observable")
@@ -149,4 +181,18 @@ TEMPLATE_TEST_CASE("concat as source", "", rpp::memory_model::use_stack, rpp::me
         CHECK(d->is_disposed());
         CHECK(d2->is_disposed());
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("concat of non random-access container resumes iteration in O(1)")
+{
+    size_t                                               increments{};
+    increments_counting_list<decltype(rpp::source::just(rpp::schedulers::immediate{}, 1))> observables{{}, &increments};
+    for (size_t i = 0; i < 1000; ++i)
+        observables.values.push_back(rpp::source::just(rpp::schedulers::immediate{}, 1));
+
+    size_t values_count{};
+    rpp::source::concat(observables).subscribe([&values_count](int) { ++values_count; });
+
+    CHECK(values_count == 1000u);
+    CHECK(increments == 1000u);
+}
@@ -0,0 +1,229 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <snitch/snitch.hpp>
+
+#include <rpp/operators/concat_map.hpp>
+#include <rpp/operators/subscribe_on.hpp>
+#include <rpp/operators/take.hpp>
+#include <rpp/schedulers/immediate.hpp>
+#include <rpp/schedulers/new_thread.hpp>
+#include <rpp/sources/create.hpp>
+#include <rpp/sources/from.hpp>
+#include <rpp/sources/just.hpp>
+#include <rpp/sources/range.hpp>
+
+#include "mock_observer.hpp"
+#include "observable_with_saved_observer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEST_CASE("concat_map emits values of observables obtained from each value one after another")
+{
+    auto mock = mock_observer_strategy<int>();
+
+    SECTION("values of synchronous observables are emitted in order")
+    {
+        rpp::source::just(rpp::schedulers::immediate{}, 1, 2, 3)
+            | rpp::operators::concat_map([](int v) { return rpp::source::just(rpp::schedulers::immediate{}, v, v * 10); })
+            | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(mock.get_received_values() == std::vector{1, 10, 2, 20, 3, 30});
+        CHECK(mock.get_on_error_count() == 0u);
+        CHECK(mock.get_on_completed_count() == 1u);
+    }
+
+    SECTION("values of non-trivial type are buffered while inner observable is active")
+    {
+        std::vector<std::string>                        received{};
+        std::vector<rpp::dynamic_observer<std::string>> observers{};
+
+        rpp::source::just(rpp::schedulers::immediate{}, std::string{"a"}, std::string{"b"}, std::string{"c"})
+            | rpp::operators::concat_map([&observers](const std::string& v) {
+                  return rpp::source::create<std::string>([v, &observers](auto&& obs) {
+                      obs.on_next(v);
+                      observers.push_back(std::forward<decltype(obs)>(obs).as_dynamic());
+                  });
+              })
+            | rpp::operators::subscribe([&](const std::string& v) { received.push_back(v); });
+
+        CHECK(received == std::vector<std::string>{"a"});
+
+        observers[0].on_completed();
+        CHECK(received == std::vector<std::string>{"a", "b"});
+
+        observers[1].on_completed();
+        CHECK(received == std::vector<std::string>{"a", "b", "c"});
+    }
+
+    SECTION("many buffered values of non-trivial type are emitted in order")
+    {
+        std::vector<std::string> values{};
+        for (size_t i = 0; i < 100; ++i)
+            values.push_back(std::string(32, 'a') + std::to_string(i));
+
+        std::vector<std::string>                        received{};
+        std::vector<rpp::dynamic_observer<std::string>> observers{};
+
+        rpp::source::from_iterable(values, rpp::schedulers::immediate{})
+            | rpp::operators::concat_map([&observers](const std::string& v) {
+                  return rpp::source::create<std::string>([v, &observers](auto&& obs) {
+                      obs.on_next(v);
+                      observers.push_back(std::forward<decltype(obs)>(obs).as_dynamic());
+                  });
+              })
+            | rpp::operators::subscribe([&](const std::string& v) { received.push_back(v); });
+
+        // completion subscribes next inner observable, which appends its observer
+        for (size_t i = 0; i < observers.size(); ++i)
+            observers[i].on_completed();
+
+        CHECK(received == values);
+    }
+
+    SECTION("exception from callable is passed as error")
+    {
+        rpp::source::just(rpp::schedulers::immediate{}, 1, 2, 3)
+            | rpp::operators::concat_map([](int v) {
+                  if (v == 2)
+                      throw std::runtime_error{""};
+                  return rpp::source::just(rpp::schedulers::immediate{}, v);
+              })
+            | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(mock.get_received_values() == std::vector{1});
+        CHECK(mock.get_on_error_count() == 1u);
+        CHECK(mock.get_on_completed_count() == 0u);
+    }
+
+    SECTION("many synchronous inner observables don't grow stack")
+    {
+        std::vector<int> values(100'000, 1);
+        size_t           received{};
+
+        rpp::source::from_iterable(values, rpp::schedulers::immediate{})
+            | rpp::operators::concat_map([](int v) { return rpp::source::just(rpp::schedulers::immediate{}, v); })
+            | rpp::operators::subscribe([&](int) { ++received; });
+
+        CHECK(received == values.size());
+    }
+}
+
+TEST_CASE("concat_map subscribes next observable only after completion of previous one")
+{
+    auto mock = mock_observer_strategy<int>();
+
+    std::vector<observable_with_saved_observer<int>> inners(3);
+    std::vector<int>                                 requested{};
+
+    observable_with_saved_observer<int> outer{};
+    outer.get_observable()
+        | rpp::operators::concat_map([&](int i) {
+              requested.push_back(i);
+              return inners[static_cast<size_t>(i)].get_observable();
+          })
+        | rpp::operators::subscribe(mock.get_observer());
+
+    outer->on_next(0);
+    outer->on_next(1);
+    outer->on_next(2);
+
+    CHECK(inners[0].is_subscribed());
+    CHECK(!inners[1].is_subscribed());
+    CHECK(requested == std::vector{0});
+
+    inners[0]->on_next(0);
+    CHECK(mock.get_received_values() == std::vector{0});
+
+    SECTION("queued values are transformed and subscribed in order")
+    {
+        inners[0]->on_completed();
+        REQUIRE(inners[1].is_subscribed());
+        CHECK(!inners[2].is_subscribed());
+        CHECK(requested == std::vector{0, 1});
+
+        inners[1]->on_next(1);
+        inners[1]->on_completed();
+        REQUIRE(inners[2].is_subscribed());
+
+        inners[2]->on_next(2);
+        CHECK(mock.get_received_values() == std::vector{0, 1, 2});
+
+        SECTION("completes only when source and all inner observables are completed")
+        {
+            outer->on_completed();
+            CHECK(mock.get_on_completed_count() == 0u);
+
+            inners[2]->on_completed();
+            CHECK(mock.get_on_completed_count() == 1u);
+        }
+    }
+
+    SECTION("error of inner observable disposes everything and drops queued values")
+    {
+        inners[0]->on_error(std::make_exception_ptr(std::runtime_error{""}));
+        CHECK(mock.get_on_error_count() == 1u);
+        CHECK(outer->is_disposed());
+        CHECK(!inners[1].is_subscribed());
+    }
+
+    SECTION("disposing of downstream disposes source and active observable")
+    {
+        observable_with_saved_observer<int> source{};
+        source.get_observable()
+            | rpp::operators::concat_map([&inners](int i) { return inners[static_cast<size_t>(i)].get_observable(); })
+            | rpp::operators::take(1)
+            | rpp::operators::subscribe(mock.get_observer());
+
+        source->on_next(1);
+        inners[1]->on_next(1);
+
+        CHECK(source->is_disposed());
+        CHECK(inners[1]->is_disposed());
+    }
+}
+
+TEST_CASE("concat_map keeps order when inner observables complete on other threads")
+{
+    constexpr int count = 200;
+
+    std::atomic<size_t> active{};
+    bool                overlapped{};
+    std::vector<int>    received{};
+    std::promise<void>  completed{};
+
+    rpp::source::range(0, count, rpp::schedulers::immediate{})
+        | rpp::operators::concat_map([&](int v) {
+              return rpp::source::create<int>([&, v](const auto& obs) {
+                         overlapped = overlapped || ++active != 1;
+                         obs.on_next(v);
+                         --active;
+                         obs.on_completed();
+                     })
+                   | rpp::operators::subscribe_on(rpp::schedulers::new_thread{});
+          })
+        | rpp::operators::subscribe([&](int v) { received.push_back(v); },
+                                    [](const std::exception_ptr&) {},
+                                    [&] { completed.set_value(); });
+
+    REQUIRE(completed.get_future().wait_for(std::chrono::seconds{10}) == std::future_status::ready);
+
+    std::vector<int> expected{};
+    for (int i = 0; i < count; ++i)
+        expected.push_back(i);
+
+    CHECK(!overlapped);
+    CHECK(received == expected);
+}
@@ -9,6 +9,15 @@
 
 #include <snitch/snitch.hpp>
 #include <rpp/disposables/disposable_wrapper.hpp>
+#include <rpp/observers/lambda_observer.hpp>
+#include <rpp/sources/create.hpp>
+
+#include <algorithm>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
 
 
 TEST_CASE("disposable keeps state")
@@ -106,3 +115,218 @@ TEST_CASE("disposable keeps state")
         CHECK(d.is_disposed());
     }
 }
+
+TEST_CASE("disposable removes disposed children")
+{
+    auto d = rpp::disposable_wrapper{std::make_shared<rpp::base_disposable>()};
+
+    auto                                child = std::make_shared<rpp::base_disposable>();
+    std::weak_ptr<rpp::base_disposable> weak_child = child;
+    d.add(child);
+    child->dispose();
+    child.reset();
+
+    std::vector<std::shared_ptr<rpp::base_disposable>> alive_children{};
+    for (size_t i = 0; i < 100; ++i)
+    {
+        alive_children.push_back(std::make_shared<rpp::base_disposable>());
+        d.add(alive_children.back());
+
+        auto disposed_child = std::make_shared<rpp::base_disposable>();
+        d.add(disposed_child);
+        disposed_child->dispose();
+    }
+
+    CHECK(weak_child.expired());
+
+    d.dispose();
+    for (const auto& alive : alive_children)
+        CHECK(alive->is_disposed());
+}
+
+TEST_CASE("disposable handles concurrent adding and disposing")
+{
+    constexpr size_t threads_count = 4;
+    constexpr size_t children_per_thread = 1000;
+
+    auto d = rpp::disposable_wrapper{std::make_shared<rpp::base_disposable>()};
+
+    std::vector<std::vector<std::shared_ptr<rpp::base_disposable>>> children(threads_count);
+    std::vector<std::thread>                                        threads{};
+    for (size_t t = 0; t < threads_count; ++t)
+    {
+        threads.emplace_back([&d, &children = children[t]]
+        {
+            for (size_t i = 0; i < children_per_thread; ++i)
+            {
+                children.push_back(std::make_shared<rpp::base_disposable>());
+                d.add(children.back());
+                if (i % 2)
+                    children.back()->dispose();
+            }
+        });
+    }
+
+    d.dispose();
+    for (auto& t : threads)
+        t.join();
+
+    for (const auto& thread_children : children)
+        for (const auto& child : thread_children)
+            CHECK(child->is_disposed());
+}
+
+TEST_CASE("disposable disposes children detached by concurrent removing of disposed children before dispose returns")
+{
+    constexpr size_t iterations = 1000;
+    // threshold of removing of disposed children is doubled each time, so 256th child triggers it over the whole list detached for a while
+    constexpr size_t children_count = 255;
+
+    size_t not_disposed{};
+    for (size_t iteration = 0; iteration < iterations; ++iteration)
+    {
+        auto d = std::make_shared<rpp::base_disposable>();
+
+        std::vector<std::shared_ptr<rpp::base_disposable>> children{};
+        for (size_t i = 0; i < children_count; ++i)
+        {
+            children.push_back(std::make_shared<rpp::base_disposable>());
+            d->add(children.back());
+        }
+
+        std::atomic<bool> started{};
+        std::thread       adder{[&] {
+            auto child = std::make_shared<rpp::base_disposable>();
+            started.store(true);
+            d->add(std::move(child));
+        }};
+
+        while (!started.load()) {}
+        d->dispose();
+
+        for (const auto& child : children)
+            not_disposed += child->is_disposed() ? 0 : 1;
+
+        adder.join();
+    }
+
+    CHECK(not_disposed == 0u);
+}
+
+TEST_CASE("disposable handles concurrent removing via handles")
+{
+    constexpr size_t threads_count       = 4;
+    constexpr size_t children_per_thread = 1000;
+
+    auto d = rpp::disposable_wrapper{std::make_shared<rpp::base_disposable>()};
+
+    std::vector<std::thread> threads{};
+    for (size_t t = 0; t < threads_count; ++t)
+    {
+        threads.emplace_back([&d]
+        {
+            for (size_t i = 0; i < children_per_thread; ++i)
+            {
+                auto child  = std::make_shared<rpp::base_disposable>();
+                auto handle = d.add_with_handle(child);
+                if (i % 3 == 0)
+                    child->dispose();
+                if (i % 2)
+                    handle.remove();
+            }
+        });
+    }
+
+    d.dispose();
+    for (auto& t : threads)
+        t.join();
+
+    CHECK(d.is_disposed());
+}
+
+TEST_CASE("disposable removes child via handle")
+{
+    auto d     = rpp::disposable_wrapper{std::make_shared<rpp::base_disposable>()};
+    auto child = std::make_shared<rpp::base_disposable>();
+
+    std::weak_ptr<rpp::base_disposable> weak_child = child;
+    auto                                handle     = d.add_with_handle(child);
+
+    SECTION("removed child is released and not disposed")
+    {
+        handle.remove();
+        CHECK(child.use_count() == 1);
+
+        d.dispose();
+        CHECK(!child->is_disposed());
+    }
+
+    SECTION("child is disposed with parent in case of handle is destroyed without removing")
+    {
+        handle = rpp::base_disposable::handle{};
+        d.dispose();
+        CHECK(child->is_disposed());
+    }
+
+    SECTION("removing after disposing of parent does nothing")
+    {
+        d.dispose();
+        CHECK(child->is_disposed());
+        handle.remove();
+        CHECK(child.use_count() == 1);
+    }
+
+    SECTION("handle outlives parent")
+    {
+        d = rpp::disposable_wrapper{};
+        handle.remove();
+        CHECK(!child->is_disposed());
+    }
+
+    SECTION("adding to disposed parent returns empty handle and disposes child")
+    {
+        d.dispose();
+        auto other = std::make_shared<rpp::base_disposable>();
+        auto other_handle = d.add_with_handle(other);
+        CHECK(other->is_disposed());
+        other_handle.remove();
+    }
+}
+
+TEST_CASE("long-living observer with disposable keeps memory bounded while upstream is replaced")
+{
+    // counts alive upstream disposables to check that replaced ones are released
+    struct counted_disposable final : rpp::base_disposable
+    {
+        explicit counted_disposable(size_t& alive)
+            : m_alive{alive}
+        {
+            ++m_alive;
+        }
+
+        ~counted_disposable() noexcept override { --m_alive; }
+
+        size_t& m_alive;
+    };
+
+    constexpr size_t total = 100'000;
+
+    size_t alive{};
+    size_t max_alive{};
+    size_t received{};
+
+    rpp::source::create<int>([&](auto&& observer) {
+        for (size_t i = 0; i < total; ++i)
+        {
+            observer.set_upstream(rpp::disposable_wrapper{std::make_shared<counted_disposable>(alive)});
+            observer.on_next(static_cast<int>(i));
+            max_alive = std::max(max_alive, alive);
+        }
+        observer.on_completed();
+    })
+        .subscribe(rpp::disposable_wrapper{std::make_shared<rpp::base_disposable>()}, [&](int) { ++received; });
+
+    CHECK(received == total);
+    CHECK(max_alive <= 2u);
+    CHECK(alive == 0u);
+}
@@ -11,12 +11,16 @@
 #include <snitch/snitch.hpp>
 
 #include <rpp/operators/filter.hpp>
+#include <rpp/operators/take.hpp>
+#include <rpp/schedulers/immediate.hpp>
 #include <rpp/sources/create.hpp>
+#include <rpp/sources/from.hpp>
 
 #include "mock_observer.hpp"
 
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 TEST_CASE("filter")
 {
@@ -51,3 +55,89 @@ TEST_CASE("filter")
         CHECK(mock.get_on_completed_count() == 0);
     }
 }
+
+TEST_CASE("filter keeps noexcept-ness of on_next")
+{
+    bool is_nothrow{};
+    auto obs = rpp::source::create<int>([&is_nothrow](const auto& obs)
+    {
+        is_nothrow = noexcept(obs.on_next(1));
+    });
+
+    SECTION("filter with noexcept callback and noexcept observer")
+    {
+        obs | rpp::operators::filter([](int v) noexcept { return v % 2 == 0; }) | rpp::operators::subscribe([](int) noexcept {});
+
+        CHECK(is_nothrow);
+    }
+
+    SECTION("filter with potentially throwing callback")
+    {
+        obs | rpp::operators::filter([](int v) { return v % 2 == 0; }) | rpp::operators::subscribe([](int) noexcept {});
+
+        CHECK(!is_nothrow);
+    }
+}
+
+TEST_CASE("filter with batch of emissions")
+{
+    batch_mock_observer_strategy<int> mock{};
+    auto obs = rpp::source::create<int>([](const auto& obs)
+    {
+        std::vector<int> values(1000);
+        for (size_t i = 0; i < values.size(); ++i)
+            values[i] = static_cast<int>(i);
+
+        obs.on_next_batch(values);
+        obs.on_completed();
+    });
+
+    obs | rpp::operators::filter([](int v) { return v % 3 == 0; }) | rpp::operators::subscribe(mock.get_observer());
+
+    std::vector<int> expected{};
+    for (int v = 0; v < 1000; v += 3)
+        expected.push_back(v);
+
+    CHECK(mock.get_mock().get_received_values() == expected);
+    CHECK(mock.get_mock().get_on_completed_count() == 1u);
+}
+
+TEST_CASE("filter invokes predicate for batch of emissions the same way as for separate emissions")
+{
+    std::vector<int> values(1000);
+    for (size_t i = 0; i < values.size(); ++i)
+        values[i] = static_cast<int>(i);
+
+    auto   mock = mock_observer_strategy<int>();
+    size_t calls{};
+
+    SECTION("predicate is invoked only till take obtains enough values")
+    {
+        rpp::source::from_iterable(values, rpp::schedulers::immediate{})
+            | rpp::operators::filter([&calls](int v) { ++calls; return v % 2 == 0; })
+            | rpp::operators::take(2)
+            | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(calls == 3u);
+        CHECK(mock.get_received_values() == std::vector{0, 2});
+        CHECK(mock.get_on_completed_count() == 1u);
+    }
+
+    SECTION("satisfying values before exception are passed before error")
+    {
+        rpp::source::from_iterable(values, rpp::schedulers::immediate{})
+            | rpp::operators::filter([&calls](int v) {
+                  ++calls;
+                  if (v == 5)
+                      throw std::runtime_error{""};
+                  return v % 2 == 0;
+              })
+            | rpp::operators::take(100)
+            | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(calls == 6u);
+        CHECK(mock.get_received_values() == std::vector{0, 2, 4});
+        CHECK(mock.get_on_error_count() == 1u);
+        CHECK(mock.get_on_completed_count() == 0u);
+    }
+}
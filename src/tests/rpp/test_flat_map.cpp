@@ -0,0 +1,217 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <snitch/snitch.hpp>
+
+#include <rpp/operators/flat_map.hpp>
+#include <rpp/operators/subscribe_on.hpp>
+#include <rpp/operators/take.hpp>
+#include <rpp/schedulers/immediate.hpp>
+#include <rpp/schedulers/new_thread.hpp>
+#include <rpp/sources/create.hpp>
+#include <rpp/sources/from.hpp>
+#include <rpp/sources/just.hpp>
+#include <rpp/sources/range.hpp>
+
+#include "mock_observer.hpp"
+#include "observable_with_saved_observer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST_CASE("flat_map emits values of observables obtained from each value")
+{
+    auto mock = mock_observer_strategy<int>();
+
+    SECTION("values of synchronous observables are emitted in order")
+    {
+        rpp::source::just(rpp::schedulers::immediate{}, 1, 2, 3)
+            | rpp::operators::flat_map([](int v) { return rpp::source::just(rpp::schedulers::immediate{}, v, v * 10); })
+            | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(mock.get_received_values() == std::vector{1, 10, 2, 20, 3, 30});
+        CHECK(mock.get_on_error_count() == 0u);
+        CHECK(mock.get_on_completed_count() == 1u);
+    }
+
+    SECTION("exception from callable is passed as error")
+    {
+        rpp::source::just(rpp::schedulers::immediate{}, 1, 2)
+            | rpp::operators::flat_map([](int v) {
+                  if (v == 2)
+                      throw std::runtime_error{""};
+                  return rpp::source::just(rpp::schedulers::immediate{}, v);
+              })
+            | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(mock.get_received_values() == std::vector{1});
+        CHECK(mock.get_on_error_count() == 1u);
+        CHECK(mock.get_on_completed_count() == 0u);
+    }
+
+    SECTION("many synchronous inner observables don't grow stack")
+    {
+        std::vector<int> values(100'000, 1);
+        size_t           received{};
+
+        rpp::source::from_iterable(values, rpp::schedulers::immediate{})
+            | rpp::operators::flat_map([](int v) { return rpp::source::just(rpp::schedulers::immediate{}, v); }, 1)
+            | rpp::operators::subscribe([&](int) { ++received; });
+
+        CHECK(received == values.size());
+    }
+
+    SECTION("disposing of downstream disposes all observables")
+    {
+        std::vector<observable_with_saved_observer<int>> others(2);
+        observable_with_saved_observer<int>              source{};
+        source.get_observable()
+            | rpp::operators::flat_map([&others](int i) { return others[static_cast<size_t>(i)].get_observable(); })
+            | rpp::operators::take(1)
+            | rpp::operators::subscribe(mock.get_observer());
+
+        source->on_next(0);
+        source->on_next(1);
+        others[1]->on_next(1);
+
+        CHECK(mock.get_received_values() == std::vector{1});
+        CHECK(source->is_disposed());
+        CHECK(others[0]->is_disposed());
+        CHECK(others[1]->is_disposed());
+    }
+}
+
+TEST_CASE("flat_map limits amount of active inner observables")
+{
+    auto mock = mock_observer_strategy<int>();
+
+    std::vector<observable_with_saved_observer<int>> inners(3);
+
+    observable_with_saved_observer<int> outer{};
+    outer.get_observable()
+        | rpp::operators::flat_map([&inners](int i) { return inners[static_cast<size_t>(i)].get_observable(); }, 2)
+        | rpp::operators::subscribe(mock.get_observer());
+
+    outer->on_next(0);
+    outer->on_next(1);
+    outer->on_next(2);
+
+    CHECK(inners[0].is_subscribed());
+    CHECK(inners[1].is_subscribed());
+    CHECK(!inners[2].is_subscribed());
+
+    inners[1]->on_next(1);
+    inners[0]->on_next(0);
+    CHECK(mock.get_received_values() == std::vector{1, 0});
+
+    SECTION("pending observable is subscribed when active one completes")
+    {
+        inners[1]->on_completed();
+        REQUIRE(inners[2].is_subscribed());
+
+        inners[2]->on_next(2);
+        CHECK(mock.get_received_values() == std::vector{1, 0, 2});
+
+        SECTION("completes only when source and all inner observables are completed")
+        {
+            outer->on_completed();
+            inners[0]->on_completed();
+            CHECK(mock.get_on_completed_count() == 0u);
+
+            inners[2]->on_completed();
+            CHECK(mock.get_on_completed_count() == 1u);
+        }
+    }
+
+    SECTION("error of inner observable disposes everything including pending ones")
+    {
+        inners[0]->on_error(std::make_exception_ptr(std::runtime_error{""}));
+        CHECK(mock.get_on_error_count() == 1u);
+        CHECK(outer->is_disposed());
+        CHECK(inners[1]->is_disposed());
+        CHECK(!inners[2].is_subscribed());
+    }
+}
+
+TEST_CASE("flat_map subscribes pending observables when inner observables complete on other threads")
+{
+    constexpr int    count           = 200;
+    constexpr size_t max_concurrency = 2;
+
+    std::atomic<size_t> active{};
+    std::atomic<size_t> max_active{};
+    std::atomic<int>    received{};
+    std::promise<void>  completed{};
+
+    rpp::source::range(0, count, rpp::schedulers::immediate{})
+        | rpp::operators::flat_map([&](int v) {
+              return rpp::source::create<int>([&, v](const auto& obs) {
+                         const auto current = ++active;
+                         size_t     prev    = max_active.load();
+                         while (prev < current && !max_active.compare_exchange_weak(prev, current)) {}
+
+                         obs.on_next(v);
+                         --active;
+                         obs.on_completed();
+                     })
+                   | rpp::operators::subscribe_on(rpp::schedulers::new_thread{});
+          },
+                                     max_concurrency)
+        | rpp::operators::subscribe([&](int) { ++received; },
+                                    [](const std::exception_ptr&) {},
+                                    [&] { completed.set_value(); });
+
+    REQUIRE(completed.get_future().wait_for(std::chrono::seconds{10}) == std::future_status::ready);
+    CHECK(received.load() == count);
+    CHECK(max_active.load() <= max_concurrency);
+}
+
+TEST_CASE("flat_map serializes emissions of concurrent inner observables")
+{
+    constexpr size_t producers_count     = 4;
+    constexpr int    values_per_producer = 20'000;
+
+    std::vector<observable_with_saved_observer<int>> inners(producers_count);
+
+    std::atomic<bool> emitting{};
+    bool              overlapped{};
+    size_t            received{};
+    size_t            completed{};
+
+    rpp::source::just(rpp::schedulers::immediate{}, size_t{0}, size_t{1}, size_t{2}, size_t{3})
+        | rpp::operators::flat_map([&inners](size_t i) { return inners[i].get_observable(); })
+        | rpp::operators::subscribe([&](int) {
+                                        overlapped = overlapped || emitting.exchange(true);
+                                        ++received;
+                                        emitting.store(false);
+                                    },
+                                    [](const std::exception_ptr&) {},
+                                    [&] { ++completed; });
+
+    std::vector<std::thread> threads{};
+    for (const auto& inner : inners)
+    {
+        threads.emplace_back([&inner] {
+            for (int i = 0; i < values_per_producer; ++i)
+                inner->on_next(i);
+            inner->on_completed();
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    CHECK(!overlapped);
+    CHECK(received == producers_count * values_per_producer);
+    CHECK(completed == 1u);
+}
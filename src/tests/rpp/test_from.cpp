@@ -11,11 +11,14 @@
 #include <snitch/snitch.hpp>
 
 #include <rpp/sources/from.hpp>
+#include <rpp/operators/subscribe_on.hpp>
 #include <rpp/operators/take.hpp>
+#include <rpp/schedulers/new_thread.hpp>
 #include <cstddef>
 #include <functional>
 #include "mock_observer.hpp"
 #include "copy_count_tracker.hpp"
+#include "counting_memory_resource.hpp"
 #include "rpp/memory_model.hpp"
 #include "rpp/observers/fwd.hpp"
 #include "rpp/schedulers/current_thread.hpp"
@@ -23,7 +26,11 @@
 #include "rpp/schedulers/immediate.hpp"
 #include "rpp/sources/fwd.hpp"
 
+#include <chrono>
+#include <future>
+#include <list>
 #include <optional>
+#include <ranges>
 #include <stdexcept>
 
 struct my_container_with_error : std::vector<int>
@@ -58,7 +65,9 @@ TEMPLATE_TEST_CASE("from iterable emit items from container",
                    std::pair<rpp::schedulers::current_thread, rpp::memory_model::use_stack>,
                    std::pair<rpp::schedulers::immediate, rpp::memory_model::use_stack>,
                    std::pair<rpp::schedulers::current_thread, rpp::memory_model::use_shared>,
-                   std::pair<rpp::schedulers::immediate, rpp::memory_model::use_shared>)
+                   std::pair<rpp::schedulers::immediate, rpp::memory_model::use_shared>,
+                   std::pair<rpp::schedulers::current_thread, rpp::memory_model::use_arena>,
+                   std::pair<rpp::schedulers::immediate, rpp::memory_model::use_arena>)
 {
     using memory_model = std::tuple_element_t<1, TestType>;
     using scheduler = std::tuple_element_t<0, TestType>;
@@ -160,7 +169,7 @@ TEMPLATE_TEST_CASE("from iterable emit items from container",
     }
 }
 
-TEMPLATE_TEST_CASE("from iterable with different schedulers", "", rpp::memory_model::use_stack, rpp::memory_model::use_shared)
+TEMPLATE_TEST_CASE("from iterable with different schedulers", "", rpp::memory_model::use_stack, rpp::memory_model::use_shared, rpp::memory_model::use_arena)
 {
     auto mock = mock_observer_strategy<int>();
 
@@ -227,6 +236,87 @@ TEMPLATE_TEST_CASE("from iterable doesn't provides extra copies", "", rpp::sched
     }
 }
 
+TEST_CASE("from iterable with arena memory model")
+{
+    counting_memory_resource resource{};
+    auto                     mock = mock_observer_strategy<int>();
+
+    SECTION("container is allocated from resource of active arena_scope and released with observable")
+    {
+        {
+            const rpp::memory_model::arena_scope scope{resource};
+            auto obs = rpp::source::just<rpp::memory_model::use_arena>(rpp::schedulers::immediate{}, 1, 2, 3);
+            CHECK(resource.get_allocations_count() == 2u); // container + control block
+            obs.subscribe(mock.get_observer());
+            obs.subscribe(mock.get_observer());
+            CHECK(resource.get_deallocations_count() == 0u);
+        }
+        CHECK(resource.get_deallocations_count() == resource.get_allocations_count());
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3, 1, 2, 3});
+        CHECK(mock.get_on_completed_count() == 2);
+    }
+
+    SECTION("schedulables scheduled inside of arena_scope are allocated from its resource")
+    {
+        const rpp::memory_model::arena_scope scope{resource};
+        rpp::schedulers::current_thread::create_worker().schedule([&mock](const auto&)
+        {
+            rpp::source::from_iterable<rpp::memory_model::use_arena>(std::vector{1, 2}).subscribe(mock.get_observer());
+            return rpp::schedulers::optional_duration{};
+        }, mock.get_observer());
+
+        CHECK(resource.get_allocations_count() == 3u); // container + control block + schedulable inside of queue
+        CHECK(resource.get_deallocations_count() == 3u);
+        CHECK(mock.get_received_values() == std::vector{1, 2});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("schedulables passed to another thread don't use resource of arena_scope")
+    {
+        std::promise<void> completed{};
+        {
+            const rpp::memory_model::arena_scope scope{resource};
+            rpp::source::just(rpp::schedulers::immediate{}, 1, 2)
+                | rpp::operators::subscribe_on(rpp::schedulers::new_thread{})
+                | rpp::operators::subscribe([&mock](int v) { mock.on_next(v); },
+                                            [](const std::exception_ptr&) {},
+                                            [&completed] { completed.set_value(); });
+        }
+        REQUIRE(completed.get_future().wait_for(std::chrono::seconds{10}) == std::future_status::ready);
+
+        CHECK(resource.get_allocations_count() == 0u);
+        CHECK(mock.get_received_values() == std::vector{1, 2});
+    }
+
+    SECTION("nested arena_scope restores previous resource")
+    {
+        counting_memory_resource nested{};
+        {
+            const rpp::memory_model::arena_scope scope{resource};
+            {
+                const rpp::memory_model::arena_scope nested_scope{nested};
+                CHECK(rpp::memory_model::arena_scope::get_resource() == &nested);
+            }
+            CHECK(rpp::memory_model::arena_scope::get_resource() == &resource);
+        }
+        CHECK(rpp::memory_model::arena_scope::get_resource() == nullptr);
+    }
+
+    SECTION("whole pipeline is released with monotonic resource")
+    {
+        std::pmr::monotonic_buffer_resource monotonic{&resource};
+        {
+            const rpp::memory_model::arena_scope scope{monotonic};
+            rpp::source::from_iterable<rpp::memory_model::use_arena>(std::vector{1, 2, 3}) | rpp::operators::take(2) | rpp::operators::subscribe(mock.get_observer());
+        }
+        CHECK(resource.get_allocations_count() > 0u);
+        CHECK(resource.get_deallocations_count() == 0u);
+        monotonic.release();
+        CHECK(resource.get_deallocations_count() == resource.get_allocations_count());
+        CHECK(mock.get_received_values() == std::vector{1, 2});
+    }
+}
+
 TEST_CASE("from callable", "[source][from]")
 {
     auto mock = mock_observer_strategy<int>{};
@@ -388,4 +478,168 @@ TEST_CASE("just variadic")
             }
         }
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("from iterable passes contiguous container as batch")
+{
+    batch_mock_observer_strategy<int> mock{};
+    const auto                        vals = std::vector{1, 2, 3, 4, 5, 6};
+
+    SECTION("immediate scheduler emits whole container as one batch")
+    {
+        rpp::source::from_iterable(vals, rpp::schedulers::immediate{}).subscribe(mock.get_observer());
+
+        CHECK(mock.get_batches_count() == 1u);
+        CHECK(mock.get_mock().get_received_values() == vals);
+        CHECK(mock.get_mock().get_on_completed_count() == 1u);
+    }
+
+    SECTION("batch is limited by take")
+    {
+        rpp::source::from_iterable(vals, rpp::schedulers::immediate{}) | rpp::operators::take(2) | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(mock.get_batches_count() == 1u);
+        CHECK(mock.get_mock().get_received_values() == std::vector{1, 2});
+        CHECK(mock.get_mock().get_on_completed_count() == 1u);
+    }
+}
+
+TEST_CASE("from iterable emits values by quantums via scheduler")
+{
+    SECTION("contiguous container is emitted by batches of quantum size")
+    {
+        batch_mock_observer_strategy<int> mock{};
+        const auto                        vals = std::vector{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+        rpp::source::from_iterable(vals, rpp::schedulers::current_thread{}, 4).subscribe(mock.get_observer());
+
+        CHECK(mock.get_batches_count() == 3u);
+        CHECK(mock.get_mock().get_received_values() == vals);
+        CHECK(mock.get_mock().get_on_completed_count() == 1u);
+    }
+
+    SECTION("zero quantum is treated as one")
+    {
+        batch_mock_observer_strategy<int> mock{};
+        const auto                        vals = std::vector{1, 2, 3};
+
+        rpp::source::from_iterable(vals, rpp::schedulers::current_thread{}, 0).subscribe(mock.get_observer());
+
+        CHECK(mock.get_batches_count() == 3u);
+        CHECK(mock.get_mock().get_received_values() == vals);
+        CHECK(mock.get_mock().get_on_completed_count() == 1u);
+    }
+
+    SECTION("sources yield to each other after each quantum")
+    {
+        std::vector<int> results{};
+        rpp::schedulers::current_thread::create_worker().schedule([&results](const auto&)
+        {
+            rpp::source::from_iterable(std::list{1, 2, 3, 4, 5, 6}, rpp::schedulers::current_thread{}, 3).subscribe([&results](int v) { results.push_back(v); });
+            rpp::source::from_iterable(std::list{10, 20, 30, 40}, rpp::schedulers::current_thread{}, 2).subscribe([&results](int v) { results.push_back(v); });
+            return rpp::schedulers::optional_duration{};
+        }, mock_observer_strategy<int>{}.get_observer());
+
+        CHECK(results == std::vector{1, 2, 3, 10, 20, 4, 5, 6, 30, 40});
+    }
+
+    SECTION("emission stops inside of quantum after disposing")
+    {
+        auto mock = mock_observer_strategy<int>();
+        rpp::source::from_iterable(std::list{1, 2, 3, 4, 5}, rpp::schedulers::current_thread{}, 10) | rpp::operators::take(2) | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(mock.get_received_values() == std::vector{1, 2});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+}
+
+TEMPLATE_TEST_CASE("from range emits values of view lazily", "", rpp::schedulers::immediate, rpp::schedulers::current_thread)
+{
+    auto mock = mock_observer_strategy<int>();
+
+    SECTION("observable from iota view emits values in the same order")
+    {
+        rpp::source::from_range(std::views::iota(1, 6), TestType{}).subscribe(mock.get_observer());
+
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3, 4, 5});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("observable from filter+transform view can be subscribed multiple times")
+    {
+        size_t     transform_calls{};
+        const auto obs = rpp::source::from_range(std::views::iota(0, 10)
+                                                     | std::views::filter([](int v) { return v % 3 == 0; })
+                                                     | std::views::transform([&transform_calls](int v) { ++transform_calls; return v * 2; }),
+                                                 TestType{},
+                                                 2);
+
+        obs.subscribe(mock.get_observer());
+        obs.subscribe(mock.get_observer());
+
+        CHECK(mock.get_received_values() == std::vector{0, 6, 12, 18, 0, 6, 12, 18});
+        CHECK(mock.get_on_completed_count() == 2);
+        CHECK(transform_calls == 8u);
+    }
+
+    SECTION("observable from infinite view with take(3) stops iteration")
+    {
+        size_t transform_calls{};
+        rpp::source::from_range(std::views::iota(0) | std::views::transform([&transform_calls](int v) { ++transform_calls; return v; }), TestType{})
+            | rpp::operators::take(3)
+            | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(mock.get_received_values() == std::vector{0, 1, 2});
+        CHECK(mock.get_on_completed_count() == 1);
+        CHECK(transform_calls == 3u);
+    }
+
+    SECTION("observable from lvalue container references it without copy")
+    {
+        copy_count_tracker tracker{};
+        std::vector        vals{tracker};
+        const auto         initial_copy = tracker.get_copy_count();
+
+        rpp::source::from_range(vals, TestType{}).subscribe([](const copy_count_tracker&) {});
+
+        CHECK(tracker.get_copy_count() - initial_copy == 0);
+    }
+
+    SECTION("contiguous view is passed as batch")
+    {
+        batch_mock_observer_strategy<int> batch_mock{};
+        const std::vector                 vals{1, 2, 3, 4, 5};
+
+        rpp::source::from_range(vals, TestType{}, 2).subscribe(batch_mock.get_observer());
+
+        CHECK(batch_mock.get_batches_count() == (std::same_as<TestType, rpp::schedulers::immediate> ? 1u : 3u));
+        CHECK(batch_mock.get_mock().get_received_values() == vals);
+        CHECK(batch_mock.get_mock().get_on_completed_count() == 1u);
+    }
+
+    SECTION("exception during iteration is passed to on_error")
+    {
+        rpp::source::from_range(std::views::iota(0, 3) | std::views::transform([](int v) -> int { if (v == 1) throw std::runtime_error{""}; return v; }), TestType{})
+            .subscribe(mock.get_observer());
+
+        CHECK(mock.get_received_values() == std::vector{0});
+        CHECK(mock.get_on_error_count() == 1);
+        CHECK(mock.get_on_completed_count() == 0);
+    }
+}
+
+TEST_CASE("from range keeps iteration state in place between quantums")
+{
+    std::vector<int> results{};
+    rpp::schedulers::current_thread::create_worker().schedule([&results](const auto&)
+    {
+        // filter_view iterator refers to view itself, so view can't be moved during iteration
+        rpp::source::from_range(std::views::iota(0, 10) | std::views::filter([](int v) { return v % 2 == 0; }), rpp::schedulers::current_thread{}, 2)
+            .subscribe([&results](int v) { results.push_back(v); });
+        rpp::source::from_range(std::views::iota(100, 103), rpp::schedulers::current_thread{}, 1)
+            .subscribe([&results](int v) { results.push_back(v); });
+        return rpp::schedulers::optional_duration{};
+    }, mock_observer_strategy<int>{}.get_observer());
+
+    CHECK(results == std::vector{0, 2, 100, 4, 6, 101, 8, 102});
+}
@@ -10,13 +10,27 @@
 
 #include <snitch/snitch.hpp>
 
+#include <rpp/operators/filter.hpp>
 #include <rpp/operators/map.hpp>
+#include <rpp/operators/take.hpp>
+#include <rpp/operators/take_while.hpp>
+#include <rpp/schedulers/immediate.hpp>
 #include <rpp/sources/create.hpp>
+#include <rpp/sources/from.hpp>
 
 #include "mock_observer.hpp"
 
 #include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <vector>
+
+template<typename T>
+struct fused_stages_count : std::integral_constant<size_t, 0> {};
+
+template<typename T, typename TObs, typename... Stages>
+struct fused_stages_count<rpp::base_observer<T, rpp::operators::details::operator_strategy_base<T, TObs, rpp::operators::details::fused_observer_strategy<Stages...>>>>
+    : std::integral_constant<size_t, sizeof...(Stages)> {};
 
 TEST_CASE("map modifies values and forward errors/completions")
 {
@@ -52,3 +66,218 @@ TEST_CASE("map modifies values and forward errors/completions")
         CHECK(mock.get_on_completed_count() == 0);
     }
 }
+
+TEST_CASE("map keeps noexcept-ness of on_next")
+{
+    bool is_nothrow{};
+    auto obs = rpp::source::create<int>([&is_nothrow](const auto& obs)
+    {
+        is_nothrow = noexcept(obs.on_next(1));
+        obs.on_next(1);
+    });
+
+    SECTION("map with noexcept callback and noexcept observer")
+    {
+        int result{};
+        obs | rpp::operators::map([](int v) noexcept { return v * 2; }) | rpp::operators::subscribe([&result](int v) noexcept { result = v; });
+
+        CHECK(is_nothrow);
+        CHECK(result == 2);
+    }
+
+    SECTION("fused maps with noexcept callbacks and noexcept observer")
+    {
+        obs | rpp::operators::map([](int v) noexcept { return v * 2; }) | rpp::operators::map([](int v) noexcept { return v * 2; }) | rpp::operators::subscribe([](int) noexcept {});
+
+        CHECK(is_nothrow);
+    }
+
+    SECTION("fused maps with one potentially throwing callback")
+    {
+        obs | rpp::operators::map([](int v) noexcept { return v * 2; }) | rpp::operators::map([](int v) { return v * 2; }) | rpp::operators::subscribe([](int) noexcept {});
+
+        CHECK(!is_nothrow);
+    }
+
+    SECTION("map with potentially throwing callback")
+    {
+        obs | rpp::operators::map([](int v) { return v * 2; }) | rpp::operators::subscribe([](int) noexcept {});
+
+        CHECK(!is_nothrow);
+    }
+
+    SECTION("map with potentially throwing observer")
+    {
+        obs | rpp::operators::map([](int v) noexcept { return v * 2; }) | rpp::operators::subscribe([](int) {});
+
+        CHECK(!is_nothrow);
+    }
+}
+
+TEST_CASE("map fuses with consecutive filter/take_while")
+{
+    size_t stages_count{};
+    auto obs = rpp::source::create<int>([&stages_count](const auto& obs)
+    {
+        stages_count = fused_stages_count<std::decay_t<decltype(obs)>>::value;
+        for (int i = 0; i < 10; ++i)
+            obs.on_next(i);
+        obs.on_completed();
+    });
+
+    mock_observer_strategy<std::string> mock{};
+
+    SECTION("chain of map/filter/take_while subscribes single fused observer")
+    {
+        obs | rpp::operators::map([](int v) { return v * 10; })
+            | rpp::operators::filter([](int v) { return v % 20 == 0; })
+            | rpp::operators::map([](int v) { return std::to_string(v); })
+            | rpp::operators::take_while([](const std::string& v) { return v != "60"; })
+            | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(stages_count == 4);
+        CHECK(mock.get_received_values() == std::vector<std::string>{"0", "20", "40"});
+        CHECK(mock.get_on_error_count() == 0);
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("fused observable can be subscribed multiple times")
+    {
+        const auto fused = obs | rpp::operators::filter([](int v) { return v < 2; }) | rpp::operators::map([](int v) { return std::to_string(v); });
+
+        fused.subscribe(mock.get_observer());
+        fused.subscribe(mock.get_observer());
+
+        CHECK(stages_count == 2);
+        CHECK(mock.get_received_values() == std::vector<std::string>{"0", "1", "0", "1"});
+        CHECK(mock.get_on_completed_count() == 2);
+    }
+
+    SECTION("exception inside of any stage is passed to on_error")
+    {
+        obs | rpp::operators::map([](int v) { return v; })
+            | rpp::operators::map([](int v) -> std::string { if (v == 1) throw std::runtime_error{""}; return std::to_string(v); })
+            | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(mock.get_received_values() == std::vector<std::string>{"0"});
+        CHECK(mock.get_on_error_count() == 1);
+        CHECK(mock.get_on_completed_count() == 0);
+    }
+}
+
+TEST_CASE("map with batch of emissions")
+{
+    std::vector<int> values(1000);
+    for (size_t i = 0; i < values.size(); ++i)
+        values[i] = static_cast<int>(i);
+
+    auto obs = rpp::source::create<int>([&values](const auto& obs)
+    {
+        obs.on_next_batch(values);
+        obs.on_completed();
+    });
+
+    SECTION("map to arithmetic type passes batches by chunks")
+    {
+        batch_mock_observer_strategy<int> mock{};
+        obs | rpp::operators::map([](int v) { return v * 2; }) | rpp::operators::subscribe(mock.get_observer());
+
+        std::vector<int> expected(values.size());
+        for (size_t i = 0; i < values.size(); ++i)
+            expected[i] = values[i] * 2;
+
+        CHECK(mock.get_batches_count() == (values.size() + rpp::operators::details::batch_chunk_size - 1) / rpp::operators::details::batch_chunk_size);
+        CHECK(mock.get_mock().get_received_values() == expected);
+        CHECK(mock.get_mock().get_on_completed_count() == 1u);
+    }
+
+    SECTION("map to non-trivial type passes values one by one")
+    {
+        batch_mock_observer_strategy<std::string> mock{};
+        obs | rpp::operators::map([](int v) { return std::to_string(v); }) | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(mock.get_batches_count() == 0u);
+        CHECK(mock.get_mock().get_received_values().size() == values.size());
+        CHECK(mock.get_mock().get_on_completed_count() == 1u);
+    }
+
+    SECTION("fused map/filter/take_while pass values to take_while one by one")
+    {
+        batch_mock_observer_strategy<int> mock{};
+        obs | rpp::operators::map([](int v) { return v + 1; })
+            | rpp::operators::filter([](int v) { return v % 2 == 0; })
+            | rpp::operators::take_while([](int v) { return v < 100; })
+            | rpp::operators::subscribe(mock.get_observer());
+
+        std::vector<int> expected{};
+        for (int v = 2; v < 100; v += 2)
+            expected.push_back(v);
+
+        // any value can stop take_while, so values are not computed ahead of it
+        CHECK(mock.get_batches_count() == expected.size());
+        CHECK(mock.get_mock().get_received_values() == expected);
+        CHECK(mock.get_mock().get_on_completed_count() == 1u);
+    }
+}
+
+TEST_CASE("map invokes callable for batch of emissions the same way as for separate emissions")
+{
+    std::vector<int> values(1000);
+    for (size_t i = 0; i < values.size(); ++i)
+        values[i] = static_cast<int>(i);
+
+    auto   mock = mock_observer_strategy<int>();
+    size_t calls{};
+
+    SECTION("callable is invoked only for values accepted by take")
+    {
+        rpp::source::from_iterable(values, rpp::schedulers::immediate{})
+            | rpp::operators::map([&calls](int v) { ++calls; return v; })
+            | rpp::operators::take(3)
+            | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(calls == 3u);
+        CHECK(mock.get_received_values() == std::vector{0, 1, 2});
+        CHECK(mock.get_on_completed_count() == 1u);
+    }
+
+    SECTION("demand of take is passed through dynamic observer")
+    {
+        (rpp::source::from_iterable(values, rpp::schedulers::immediate{}) | rpp::operators::map([&calls](int v) { ++calls; return v; })).as_dynamic()
+            | rpp::operators::take(3)
+            | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(calls == 3u);
+        CHECK(mock.get_received_values() == std::vector{0, 1, 2});
+    }
+
+    SECTION("callable is invoked only till take_while stops")
+    {
+        rpp::source::from_iterable(values, rpp::schedulers::immediate{})
+            | rpp::operators::map([&calls](int v) { ++calls; return v; })
+            | rpp::operators::take_while([](int v) { return v < 3; })
+            | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(calls == 4u);
+        CHECK(mock.get_received_values() == std::vector{0, 1, 2});
+        CHECK(mock.get_on_completed_count() == 1u);
+    }
+
+    SECTION("values computed before exception are passed before error")
+    {
+        rpp::source::from_iterable(values, rpp::schedulers::immediate{})
+            | rpp::operators::map([&calls](int v) {
+                  ++calls;
+                  if (v == 5)
+                      throw std::runtime_error{""};
+                  return v;
+              })
+            | rpp::operators::take(100)
+            | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(calls == 6u);
+        CHECK(mock.get_received_values() == std::vector{0, 1, 2, 3, 4});
+        CHECK(mock.get_on_error_count() == 1u);
+        CHECK(mock.get_on_completed_count() == 0u);
+    }
+}
@@ -0,0 +1,193 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <snitch/snitch.hpp>
+
+#include <rpp/operators/merge.hpp>
+#include <rpp/operators/take.hpp>
+#include <rpp/schedulers/immediate.hpp>
+#include <rpp/sources/create.hpp>
+#include <rpp/sources/from.hpp>
+
+#include "mock_observer.hpp"
+#include "observable_with_saved_observer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST_CASE("merge emits values of all observables")
+{
+    auto mock = mock_observer_strategy<int>();
+
+    SECTION("observable of observables")
+    {
+        rpp::source::just(rpp::schedulers::immediate{}, rpp::source::just(rpp::schedulers::immediate{}, 1, 2).as_dynamic(), rpp::source::just(rpp::schedulers::immediate{}, 3).as_dynamic())
+            | rpp::operators::merge()
+            | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3});
+        CHECK(mock.get_on_error_count() == 0u);
+        CHECK(mock.get_on_completed_count() == 1u);
+    }
+
+    SECTION("merge_with")
+    {
+        rpp::source::just(rpp::schedulers::immediate{}, 1)
+            | rpp::operators::merge_with(rpp::source::just(rpp::schedulers::immediate{}, 2, 3), rpp::source::create<int>([](const auto& obs) {
+                                             obs.on_next(4);
+                                             obs.on_completed();
+                                         }))
+            | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3, 4});
+        CHECK(mock.get_on_completed_count() == 1u);
+    }
+
+    SECTION("values are interleaved in order of emission")
+    {
+        observable_with_saved_observer<int> first{};
+        observable_with_saved_observer<int> second{};
+
+        first.get_observable() | rpp::operators::merge_with(second.get_observable()) | rpp::operators::subscribe(mock.get_observer());
+
+        first->on_next(1);
+        second->on_next(2);
+        first->on_next(3);
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3});
+
+        SECTION("completes only when all observables are completed")
+        {
+            first->on_completed();
+            CHECK(mock.get_on_completed_count() == 0u);
+
+            second->on_next(4);
+            second->on_completed();
+            CHECK(mock.get_received_values() == std::vector{1, 2, 3, 4});
+            CHECK(mock.get_on_completed_count() == 1u);
+        }
+
+        SECTION("error of any observable is passed immediately and disposes others")
+        {
+            second->on_error(std::make_exception_ptr(std::runtime_error{""}));
+            CHECK(mock.get_on_error_count() == 1u);
+            CHECK(first->is_disposed());
+
+            first->on_next(5);
+            CHECK(mock.get_received_values() == std::vector{1, 2, 3});
+        }
+    }
+
+    SECTION("disposable of completed observable is released while merge is alive")
+    {
+        observable_with_saved_observer<int> first{};
+        std::weak_ptr<rpp::base_disposable> inner_disposable{};
+
+        first.get_observable()
+            | rpp::operators::merge_with(rpp::source::create<int>([&inner_disposable](auto&& obs) {
+                  auto d           = std::make_shared<rpp::base_disposable>();
+                  inner_disposable = d;
+                  obs.set_upstream(rpp::disposable_wrapper{d});
+                  obs.on_completed();
+              }))
+            | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(inner_disposable.expired());
+        CHECK(!first->is_disposed());
+        CHECK(mock.get_on_completed_count() == 0u);
+    }
+
+    SECTION("disposing of downstream disposes all observables")
+    {
+        observable_with_saved_observer<int> first{};
+        observable_with_saved_observer<int> second{};
+
+        first.get_observable() | rpp::operators::merge_with(second.get_observable()) | rpp::operators::take(2) | rpp::operators::subscribe(mock.get_observer());
+
+        first->on_next(1);
+        second->on_next(2);
+
+        CHECK(mock.get_received_values() == std::vector{1, 2});
+        CHECK(mock.get_on_completed_count() == 1u);
+        CHECK(first->is_disposed());
+        CHECK(second->is_disposed());
+    }
+}
+
+TEST_CASE("merge serializes emissions")
+{
+    SECTION("value emitted during emission of another value is passed after it")
+    {
+        observable_with_saved_observer<int> first{};
+        observable_with_saved_observer<int> second{};
+
+        std::vector<int> received{};
+        size_t           depth{};
+        size_t           max_depth{};
+
+        first.get_observable() | rpp::operators::merge_with(second.get_observable()) | rpp::operators::subscribe([&](int v) {
+            max_depth = std::max(max_depth, ++depth);
+            received.push_back(v);
+            if (v == 1)
+                second->on_next(2);
+            --depth;
+        });
+
+        first->on_next(1);
+
+        CHECK(received == std::vector{1, 2});
+        CHECK(max_depth == 1u);
+    }
+
+    SECTION("values from concurrent producers are not lost and never overlap")
+    {
+        constexpr size_t producers_count     = 4;
+        constexpr int    values_per_producer = 20'000;
+
+        std::vector<observable_with_saved_observer<int>>   sources(producers_count);
+        std::vector<decltype(sources[0].get_observable())> observables{};
+        for (const auto& source : sources)
+            observables.push_back(source.get_observable());
+
+        std::atomic<bool> emitting{};
+        bool              overlapped{};
+        size_t            received{};
+        size_t            completed{};
+
+        rpp::source::from_iterable(observables, rpp::schedulers::immediate{})
+            | rpp::operators::merge()
+            | rpp::operators::subscribe([&](int) {
+                                            overlapped = overlapped || emitting.exchange(true);
+                                            ++received;
+                                            emitting.store(false);
+                                        },
+                                        [](const std::exception_ptr&) {},
+                                        [&] { ++completed; });
+
+        std::vector<std::thread> threads{};
+        for (const auto& source : sources)
+        {
+            threads.emplace_back([&source] {
+                for (int i = 0; i < values_per_producer; ++i)
+                    source->on_next(i);
+                source->on_completed();
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+
+        CHECK(!overlapped);
+        CHECK(received == producers_count * values_per_producer);
+        CHECK(completed == 1u);
+    }
+}
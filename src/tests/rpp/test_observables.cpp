@@ -12,6 +12,9 @@
 #include <rpp/observables.hpp>
 #include <rpp/sources/create.hpp>
 
+#include <array>
+#include <vector>
+
 TEST_CASE("create observable works properly as base_observable")
 {
     size_t on_subscribe_called{};
@@ -83,4 +86,35 @@ TEST_CASE("create observable works properly as base_observable")
     {
         test(std::move(observable).as_dynamic()); // NOLINT
     }
-}
\ No newline at end of file
+}
+TEST_CASE("dynamic observable keeps original observable after copies and moves")
+{
+    auto test = [](auto&& observable)
+    {
+        auto dynamic = std::forward<decltype(observable)>(observable).as_dynamic();
+        auto copy    = dynamic; // NOLINT
+        auto moved   = std::move(dynamic);
+
+        for (const auto& obs : {copy, moved})
+        {
+            std::vector<int> on_next_vals{};
+            obs.subscribe([&](int v) { on_next_vals.push_back(v); });
+            CHECK(on_next_vals == std::vector{1});
+        }
+    };
+
+    SECTION("small observable")
+    {
+        test(rpp::source::create<int>([](auto&& observer) { observer.on_next(1); }));
+    }
+
+    SECTION("large observable")
+    {
+        test(rpp::source::create<int>([padding = std::array<int, 32>{}](auto&& observer) { observer.on_next(1 + padding[0]); }));
+    }
+
+    SECTION("observable with non-trivial copy")
+    {
+        test(rpp::source::create<int>([values = std::vector{1}](auto&& observer) { observer.on_next(values[0]); }));
+    }
+}
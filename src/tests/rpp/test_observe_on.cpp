@@ -0,0 +1,191 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <snitch/snitch.hpp>
+
+#include <rpp/operators/observe_on.hpp>
+#include <rpp/operators/take.hpp>
+#include <rpp/schedulers/immediate.hpp>
+#include <rpp/schedulers/new_thread.hpp>
+#include <rpp/schedulers/run_loop.hpp>
+#include <rpp/sources/create.hpp>
+#include <rpp/sources/from.hpp>
+#include <rpp/sources/range.hpp>
+
+#include "mock_observer.hpp"
+
+#include <future>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("observe_on emits values via scheduler")
+{
+    auto                      mock = mock_observer_strategy<int>();
+    rpp::schedulers::run_loop loop{};
+
+    SECTION("values are emitted only when scheduler executes schedulable")
+    {
+        rpp::source::just(rpp::schedulers::immediate{}, 1, 2, 3) | rpp::operators::observe_on(loop) | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(mock.get_total_on_next_count() == 0u);
+        CHECK(!loop.is_empty());
+
+        SECTION("one schedulable drains all values and completion")
+        {
+            CHECK(loop.dispatch_if_ready());
+            CHECK(loop.is_empty());
+
+            CHECK(mock.get_received_values() == std::vector{1, 2, 3});
+            CHECK(mock.get_on_error_count() == 0u);
+            CHECK(mock.get_on_completed_count() == 1u);
+        }
+    }
+
+    SECTION("error is emitted after values")
+    {
+        rpp::source::create<int>([](const auto& obs) {
+            obs.on_next(1);
+            obs.on_error(std::make_exception_ptr(std::runtime_error{""}));
+        })
+            | rpp::operators::observe_on(loop)
+            | rpp::operators::subscribe(mock.get_observer());
+
+        while (loop.dispatch_if_ready()) {}
+
+        CHECK(mock.get_received_values() == std::vector{1});
+        CHECK(mock.get_on_error_count() == 1u);
+        CHECK(mock.get_on_completed_count() == 0u);
+    }
+
+    SECTION("values exceeding one segment of queue are emitted in original order")
+    {
+        constexpr size_t count = rpp::operators::details::observe_on_segment_capacity<int> * 3 + 5;
+
+        rpp::source::range(0, count, rpp::schedulers::immediate{}) | rpp::operators::observe_on(loop) | rpp::operators::subscribe(mock.get_observer());
+
+        // one drain emits limited amount of values and re-schedules itself for the rest
+        loop.dispatch_if_ready();
+        CHECK(mock.get_total_on_next_count() == rpp::operators::details::observe_on_drain_limit);
+
+        while (loop.dispatch_if_ready()) {}
+
+        std::vector<int> expected(count);
+        for (size_t i = 0; i < count; ++i)
+            expected[i] = static_cast<int>(i);
+
+        CHECK(mock.get_received_values() == expected);
+        CHECK(mock.get_on_completed_count() == 1u);
+    }
+
+    SECTION("values emitted between dispatches are not lost")
+    {
+        std::optional<rpp::dynamic_observer<int>> source_observer{};
+        rpp::source::create<int>([&](auto&& obs) { source_observer.emplace(std::forward<decltype(obs)>(obs).as_dynamic()); })
+            | rpp::operators::observe_on(loop)
+            | rpp::operators::subscribe(mock.get_observer());
+
+        source_observer->on_next(1);
+        while (loop.dispatch_if_ready()) {}
+        CHECK(mock.get_received_values() == std::vector{1});
+
+        source_observer->on_next(2);
+        source_observer->on_next(3);
+        source_observer->on_completed();
+        while (loop.dispatch_if_ready()) {}
+
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3});
+        CHECK(mock.get_on_completed_count() == 1u);
+    }
+
+    SECTION("disposing of downstream disposes upstream and drops pending values")
+    {
+        std::optional<rpp::dynamic_observer<int>> source_observer{};
+        rpp::source::create<int>([&](auto&& obs) {
+            obs.on_next(1);
+            obs.on_next(2);
+            obs.on_next(3);
+            source_observer.emplace(std::forward<decltype(obs)>(obs).as_dynamic());
+        })
+            | rpp::operators::observe_on(loop)
+            | rpp::operators::take(2)
+            | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(!source_observer->is_disposed());
+        while (loop.dispatch_if_ready()) {}
+
+        CHECK(mock.get_received_values() == std::vector{1, 2});
+        CHECK(mock.get_on_completed_count() == 1u);
+        CHECK(source_observer->is_disposed());
+    }
+}
+
+TEST_CASE("observe_on passes values by batches to downstream supporting them")
+{
+    rpp::schedulers::run_loop         loop{};
+    batch_mock_observer_strategy<int> mock{};
+
+    constexpr size_t count = 100;
+    rpp::source::range(0, count, rpp::schedulers::immediate{}) | rpp::operators::observe_on(loop) | rpp::operators::subscribe(mock.get_observer());
+    while (loop.dispatch_if_ready()) {}
+
+    CHECK(mock.get_batches_count() == 1u);
+    CHECK(mock.get_mock().get_total_on_next_count() == count);
+    CHECK(mock.get_mock().get_on_completed_count() == 1u);
+}
+
+TEST_CASE("observe_on moves non-trivial values through several segments of queue")
+{
+    rpp::schedulers::run_loop loop{};
+    auto                      mock = mock_observer_strategy<std::string>();
+
+    // segment of non-trivial values is smaller to keep memory of segment bounded
+    CHECK(rpp::operators::details::observe_on_segment_capacity<std::string> < rpp::operators::details::observe_on_segment_capacity<int>);
+
+    std::vector<std::string> values{};
+    for (size_t i = 0; i < rpp::operators::details::observe_on_segment_capacity<std::string> * 2 + 10; ++i)
+        values.push_back(std::string(32, 'a') + std::to_string(i));
+
+    rpp::source::from_iterable(values, rpp::schedulers::immediate{}) | rpp::operators::observe_on(loop) | rpp::operators::subscribe(mock.get_observer());
+    while (loop.dispatch_if_ready()) {}
+
+    CHECK(mock.get_received_values() == values);
+    CHECK(mock.get_on_next_move_count() == values.size());
+    CHECK(mock.get_on_completed_count() == 1u);
+}
+
+TEST_CASE("observe_on with new_thread emits values on another thread")
+{
+    constexpr int count = 100'000;
+
+    std::vector<int>   received{};
+    std::thread::id    emission_thread{};
+    std::promise<void> completed{};
+
+    rpp::source::range(0, count, rpp::schedulers::immediate{})
+        | rpp::operators::observe_on(rpp::schedulers::new_thread{})
+        | rpp::operators::subscribe([&](int v) {
+                                        emission_thread = std::this_thread::get_id();
+                                        received.push_back(v);
+                                    },
+                                    [](const std::exception_ptr&) {},
+                                    [&] { completed.set_value(); });
+
+    completed.get_future().wait();
+
+    CHECK(emission_thread != std::this_thread::get_id());
+    REQUIRE(received.size() == static_cast<size_t>(count));
+    bool in_order = true;
+    for (int i = 0; i < count; ++i)
+        in_order = in_order && received[static_cast<size_t>(i)] == i;
+    CHECK(in_order);
+}
@@ -11,7 +11,13 @@
 #include <snitch/snitch.hpp>
 #include <rpp/observers.hpp>
 
+#include "mock_observer.hpp"
+
+#include <array>
+#include <atomic>
 #include <memory>
+#include <thread>
+#include <utility>
 #include <vector>
 
 TEST_CASE("lambda observer works properly as base observer")
@@ -114,6 +120,107 @@ TEST_CASE("as_dynamic keeps disposing")
     }
 }
 
+TEST_CASE("dynamic_observer keeps the same observer after moves and copies")
+{
+    std::vector<int> on_next_vals{};
+    size_t           on_completed{};
+
+    auto check = [&](auto&& observer)
+    {
+        auto dynamic = std::forward<decltype(observer)>(observer).as_dynamic();
+
+        SECTION("move")
+        {
+            auto moved = std::move(dynamic);
+            moved.on_next(1);
+            moved.on_completed();
+            CHECK(on_next_vals == std::vector{1});
+            CHECK(on_completed == 1u);
+            CHECK(moved.is_disposed());
+        }
+
+        SECTION("copy, move of copy and dispose")
+        {
+            auto copy  = dynamic; // NOLINT
+            auto moved = std::move(copy);
+            dynamic.on_next(1);
+            moved.on_next(2);
+            moved.on_completed();
+            CHECK(on_next_vals == std::vector{1, 2});
+            CHECK(on_completed == 1u);
+            CHECK(dynamic.is_disposed());
+        }
+    };
+
+    SECTION("small observer")
+    {
+        check(rpp::make_lambda_observer<int>([&](int v) { on_next_vals.push_back(v); }, [](const std::exception_ptr&) {}, [&]() { ++on_completed; }));
+    }
+    SECTION("large observer")
+    {
+        check(rpp::make_lambda_observer<int>([&, padding = std::array<char, 128>{}](int v) { on_next_vals.push_back(v + padding[0]); }, [](const std::exception_ptr&) {}, [&]() { ++on_completed; }));
+    }
+}
+
+TEST_CASE("dynamic_observer copies observer with external disposable instead of sharing it")
+{
+    size_t on_next_count{};
+    auto   d        = rpp::disposable_wrapper{std::make_shared<rpp::base_disposable>()};
+    auto   observer = rpp::make_lambda_observer<int>(d, [&](int) { ++on_next_count; }, [](const std::exception_ptr&) {}, []() {});
+    static_assert(std::is_copy_constructible_v<decltype(observer)>, "observer with external disposable and copyable callbacks should be copy constructible");
+
+    const auto dynamic = std::move(observer).as_dynamic();
+    auto       copy    = dynamic; // NOLINT
+
+    copy.on_next(1);
+    dynamic.on_next(2);
+    CHECK(on_next_count == 2u);
+
+    SECTION("copies share disposed state")
+    {
+        copy.on_completed();
+        CHECK(d.is_disposed());
+        CHECK(dynamic.is_disposed());
+
+        dynamic.on_next(3);
+        CHECK(on_next_count == 2u);
+    }
+}
+
+TEST_CASE("dynamic_observer can be copied concurrently with emissions")
+{
+    constexpr size_t count = 10'000;
+
+    std::atomic<size_t> on_next_count{};
+
+    auto check = [&](auto&& observer)
+    {
+        const auto dynamic = std::forward<decltype(observer)>(observer).as_dynamic();
+
+        std::thread copier{[&dynamic] {
+            for (size_t i = 0; i < count; ++i)
+            {
+                auto copy = dynamic; // NOLINT
+                copy.on_next(1);
+            }
+        }};
+        for (size_t i = 0; i < count; ++i)
+            dynamic.on_next(1);
+        copier.join();
+
+        CHECK(on_next_count.load() == 2 * count);
+    };
+
+    SECTION("shared observer")
+    {
+        check(rpp::make_lambda_observer<int>([&](int) { ++on_next_count; }, [](const std::exception_ptr&) {}, []() {}));
+    }
+    SECTION("inline observer")
+    {
+        check(rpp::make_lambda_observer<int>(rpp::disposable_wrapper{std::make_shared<rpp::base_disposable>()}, [&](int) { ++on_next_count; }, [](const std::exception_ptr&) {}, []() {}));
+    }
+}
+
 TEST_CASE("observer disposes disposable on termination callbacks")
 {
     auto d = rpp::disposable_wrapper{std::make_shared<rpp::base_disposable>()};
@@ -261,3 +368,64 @@ TEST_CASE("set_upstream disposing when empty base disposable")
     SECTION("dynamic observer")
         test_observer(std::move(original_observer).as_dynamic());
 }
+
+TEST_CASE("observer passes batch of values")
+{
+    const std::vector<int> values{1, 2, 3};
+
+    SECTION("strategy with batch obtains whole batch at once")
+    {
+        batch_mock_observer_strategy<int> mock{};
+        mock.get_observer().on_next_batch(values);
+
+        CHECK(mock.get_batches_count() == 1u);
+        CHECK(mock.get_mock().get_received_values() == values);
+    }
+
+    SECTION("dynamic observer keeps batch")
+    {
+        batch_mock_observer_strategy<int> mock{};
+        mock.get_observer().as_dynamic().on_next_batch(values);
+
+        CHECK(mock.get_batches_count() == 1u);
+        CHECK(mock.get_mock().get_received_values() == values);
+    }
+
+    SECTION("strategy without batch obtains values one by one")
+    {
+        mock_observer_strategy<int> mock{};
+        mock.get_observer().on_next_batch(values);
+
+        CHECK(mock.get_on_next_const_ref_count() == 3u);
+        CHECK(mock.get_received_values() == values);
+    }
+
+    SECTION("strategy without batch obtains values till observer is disposed")
+    {
+        std::vector<int> received{};
+        auto             d        = rpp::disposable_wrapper{std::make_shared<rpp::base_disposable>()};
+        auto             observer = rpp::make_lambda_observer<int>(d, [&](int v) { received.push_back(v); if (v == 2) d.dispose(); });
+        observer.on_next_batch(values);
+
+        CHECK(received == std::vector{1, 2});
+    }
+}
+
+TEST_CASE("observer with disposable doesn't keep replaced upstreams inside of disposable")
+{
+    auto d        = rpp::disposable_wrapper{std::make_shared<rpp::base_disposable>()};
+    auto observer = rpp::make_lambda_observer<int>(d, [](int) {}, [](const std::exception_ptr&) {}, []() {});
+
+    auto                                first_upstream = std::make_shared<rpp::base_disposable>();
+    std::weak_ptr<rpp::base_disposable> weak_first     = first_upstream;
+    observer.set_upstream(rpp::disposable_wrapper{std::exchange(first_upstream, nullptr)});
+
+    auto second_upstream = std::make_shared<rpp::base_disposable>();
+    observer.set_upstream(rpp::disposable_wrapper{second_upstream});
+
+    CHECK(weak_first.expired());
+    CHECK(!second_upstream->is_disposed());
+
+    d.dispose();
+    CHECK(second_upstream->is_disposed());
+}
@@ -0,0 +1,138 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <snitch/snitch.hpp>
+
+#include <rpp/operators/filter.hpp>
+#include <rpp/operators/map.hpp>
+#include <rpp/operators/take.hpp>
+#include <rpp/schedulers/current_thread.hpp>
+#include <rpp/schedulers/immediate.hpp>
+#include <rpp/sources/range.hpp>
+
+#include "mock_observer.hpp"
+
+#include <vector>
+
+TEMPLATE_TEST_CASE("range emits sequential values", "", rpp::schedulers::immediate, rpp::schedulers::current_thread)
+{
+    auto mock = mock_observer_strategy<int>();
+
+    SECTION("range emits count values starting from first")
+    {
+        rpp::source::range(-2, 5, TestType{}).subscribe(mock.get_observer());
+
+        CHECK(mock.get_received_values() == std::vector{-2, -1, 0, 1, 2});
+        CHECK(mock.get_on_error_count() == 0);
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("range with zero count emits only on_completed")
+    {
+        rpp::source::range(10, 0, TestType{}).subscribe(mock.get_observer());
+
+        CHECK(mock.get_received_values().empty());
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("range can be subscribed multiple times")
+    {
+        const auto obs = rpp::source::range(1, 2, TestType{});
+        obs.subscribe(mock.get_observer());
+        obs.subscribe(mock.get_observer());
+
+        CHECK(mock.get_received_values() == std::vector{1, 2, 1, 2});
+        CHECK(mock.get_on_completed_count() == 2);
+    }
+
+    SECTION("range with take stops emission")
+    {
+        rpp::source::range(0, 1'000'000, TestType{}) | rpp::operators::take(3) | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(mock.get_received_values() == std::vector{0, 1, 2});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+}
+
+TEMPLATE_TEST_CASE("range passes values by batches to downstream supporting them", "", rpp::schedulers::immediate, rpp::schedulers::current_thread)
+{
+    constexpr size_t count = 1000;
+
+    std::vector<int> expected(count);
+    for (size_t i = 0; i < count; ++i)
+        expected[i] = static_cast<int>(i);
+
+    SECTION("values are passed by chunks")
+    {
+        batch_mock_observer_strategy<int> mock{};
+        rpp::source::range(0, count, TestType{}, count).subscribe(mock.get_observer());
+
+        CHECK(mock.get_batches_count() == (count + rpp::operators::details::batch_chunk_size - 1) / rpp::operators::details::batch_chunk_size);
+        CHECK(mock.get_mock().get_received_values() == expected);
+        CHECK(mock.get_mock().get_on_completed_count() == 1u);
+    }
+
+    SECTION("chunks are limited by emission quantum for non-immediate scheduler")
+    {
+        batch_mock_observer_strategy<int> mock{};
+        rpp::source::range(0, count, TestType{}, 100).subscribe(mock.get_observer());
+
+        CHECK(mock.get_batches_count() == (std::same_as<TestType, rpp::schedulers::immediate> ? 4u : 10u));
+        CHECK(mock.get_mock().get_received_values() == expected);
+        CHECK(mock.get_mock().get_on_completed_count() == 1u);
+    }
+
+    SECTION("fused map/filter pass batches")
+    {
+        batch_mock_observer_strategy<int> mock{};
+        rpp::source::range(0, count, TestType{}, count)
+            | rpp::operators::map([](int v) { return v * 2; })
+            | rpp::operators::filter([](int v) { return v % 4 == 0; })
+            | rpp::operators::subscribe(mock.get_observer());
+
+        std::vector<int> filtered{};
+        for (const auto v : expected)
+            if ((v * 2) % 4 == 0)
+                filtered.push_back(v * 2);
+
+        CHECK(mock.get_batches_count() == (count + rpp::operators::details::batch_chunk_size - 1) / rpp::operators::details::batch_chunk_size);
+        CHECK(mock.get_mock().get_received_values() == filtered);
+        CHECK(mock.get_mock().get_on_completed_count() == 1u);
+    }
+}
+
+TEMPLATE_TEST_CASE("range doesn't generate values ahead of downstream demand", "", rpp::schedulers::immediate, rpp::schedulers::current_thread)
+{
+    auto   mock = mock_observer_strategy<int>();
+    size_t calls{};
+
+    SECTION("predicate of filter is invoked only till take obtains enough values")
+    {
+        rpp::source::range(0, 1000, TestType{}, 1000)
+            | rpp::operators::filter([&calls](int v) { ++calls; return v % 2 == 1; })
+            | rpp::operators::take(1)
+            | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(calls == 2u);
+        CHECK(mock.get_received_values() == std::vector{1});
+        CHECK(mock.get_on_completed_count() == 1u);
+    }
+
+    SECTION("callable of map is invoked only for values accepted by take")
+    {
+        rpp::source::range(0, 1000, TestType{}, 1000)
+            | rpp::operators::map([&calls](int v) { ++calls; return v; })
+            | rpp::operators::take(3)
+            | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(calls == 3u);
+        CHECK(mock.get_received_values() == std::vector{0, 1, 2});
+    }
+}
@@ -13,6 +13,8 @@
 #include <rpp/operators/repeat.hpp>
 #include <rpp/operators/take.hpp>
 #include <rpp/sources/create.hpp>
+#include <rpp/schedulers/immediate.hpp>
+#include <rpp/sources/from.hpp>
 
 #include "mock_observer.hpp"
 
@@ -115,4 +117,34 @@ TEST_CASE("repeat resubscribes")
             }
         }
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("repeat of synchronous observable doesn't grow stack")
+{
+    constexpr size_t count = 1'000'000;
+
+    SECTION("repeat of just with immediate scheduler")
+    {
+        size_t values_count{};
+        size_t completions_count{};
+        rpp::source::just(rpp::schedulers::immediate{}, 1) | rpp::operators::repeat(count) | rpp::operators::subscribe([&values_count](int) { ++values_count; }, [](const std::exception_ptr&) {}, [&completions_count]() { ++completions_count; });
+
+        CHECK(values_count == count);
+        CHECK(completions_count == 1u);
+    }
+
+    SECTION("nested repeats of synchronous observable")
+    {
+        size_t values_count{};
+        rpp::source::just(rpp::schedulers::immediate{}, 1) | rpp::operators::repeat(1000) | rpp::operators::repeat(1000) | rpp::operators::subscribe([&values_count](int) { ++values_count; });
+
+        CHECK(values_count == count);
+    }
+    SECTION("infinite repeat limited by take")
+    {
+        size_t values_count{};
+        rpp::source::just(rpp::schedulers::immediate{}, 1) | rpp::operators::repeat() | rpp::operators::take(count) | rpp::operators::subscribe([&values_count](int) { ++values_count; });
+
+        CHECK(values_count == count);
+    }
+}
@@ -14,8 +14,15 @@
 #include <rpp/schedulers.hpp>
 #include <rpp/observers/lambda_observer.hpp>
 
+#include "test_scheduler.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <future>
 #include <optional>
+#include <set>
 #include <sstream>
 #include <thread>
 
@@ -573,9 +580,811 @@ TEST_CASE("current_thread scheduler")
         CHECK(executions == std::vector{1,2,3});
     }
 
+    SECTION("current_thread scheduler interleaves due schedulables re-scheduled without delay")
+    {
+        std::vector<int> executions{};
+        worker.schedule([&executions, &worker](const auto& obs) -> rpp::schedulers::optional_duration
+                        {
+                            for (int id : {1, 2})
+                            {
+                                worker.schedule([&executions, id, count = 0](const auto&) mutable -> rpp::schedulers::optional_duration
+                                                {
+                                                    executions.push_back(id);
+                                                    if (++count < 3)
+                                                        return rpp::schedulers::duration{};
+                                                    return std::nullopt;
+                                                }, obs);
+                            }
+                            return rpp::schedulers::optional_duration{};
+                        },
+                        obs);
+
+        CHECK(executions == std::vector{1, 2, 1, 2, 1, 2});
+    }
+
+    SECTION("current_thread scheduler executes schedulable without delay after delayed one which is due already")
+    {
+        std::vector<int> executions{};
+        worker.schedule([&executions, &worker](const auto& obs) -> rpp::schedulers::optional_duration
+                        {
+                            worker.schedule(std::chrono::milliseconds{1}, [&executions](const auto&){executions.push_back(1); return rpp::schedulers::optional_duration{};}, obs);
+                            std::this_thread::sleep_for(std::chrono::milliseconds{5});
+                            worker.schedule([&executions](const auto&){executions.push_back(2); return rpp::schedulers::optional_duration{};}, obs);
+                            return rpp::schedulers::optional_duration{};
+                        },
+                        obs);
+
+        CHECK(executions == std::vector{1, 2});
+    }
+
+    SECTION("current_thread scheduler with spin before sleep threshold respects to time point")
+    {
+        rpp::schedulers::current_thread::set_spin_before_sleep_threshold(std::chrono::milliseconds{1});
+
+        std::vector<rpp::schedulers::duration> delays{};
+        const auto                             start = rpp::schedulers::clock_type::now();
+        worker.schedule([&](const auto& obs) -> rpp::schedulers::optional_duration
+                        {
+                            worker.schedule(std::chrono::microseconds{50}, [&](const auto&){ delays.push_back(rpp::schedulers::clock_type::now() - start); return rpp::schedulers::optional_duration{}; }, obs);
+                            worker.schedule(std::chrono::milliseconds{5}, [&](const auto&){ delays.push_back(rpp::schedulers::clock_type::now() - start); return rpp::schedulers::optional_duration{}; }, obs);
+                            return rpp::schedulers::optional_duration{};
+                        },
+                        obs);
+
+        rpp::schedulers::current_thread::set_spin_before_sleep_threshold(rpp::schedulers::duration::zero());
+
+        REQUIRE(delays.size() == 2);
+        CHECK(delays[0] >= std::chrono::microseconds{50});
+        CHECK(delays[1] >= std::chrono::milliseconds{5});
+    }
+
     SECTION("current_thread scheduler forwards any arguments")
     {
         worker.schedule([](const auto&, int, const std::string&){ return rpp::schedulers::optional_duration{}; }, obs, int{}, std::string{});
     }
 }
 
+
+TEST_CASE("new_thread scheduler")
+{
+    auto d   = rpp::disposable_wrapper{std::make_shared<rpp::base_disposable>()};
+    auto obs = rpp::make_lambda_observer(d, [](int){ }).as_dynamic();
+
+    auto worker = rpp::schedulers::new_thread::create_worker();
+    CHECK(!worker.get_disposable().is_disposed());
+
+    std::promise<void> done{};
+    auto               future = done.get_future();
+    const auto         wait   = [&future] { return future.wait_for(std::chrono::seconds{5}) == std::future_status::ready; };
+
+    SECTION("new_thread scheduler executes schedulables of each worker in its own thread")
+    {
+        std::thread::id first_id{};
+        std::thread::id second_id{};
+        std::promise<void> second_done{};
+
+        worker.schedule([&](const auto&)
+        {
+            first_id = std::this_thread::get_id();
+            done.set_value();
+            return rpp::schedulers::optional_duration{};
+        }, obs);
+
+        rpp::schedulers::new_thread::create_worker().schedule([&](const auto&)
+        {
+            second_id = std::this_thread::get_id();
+            second_done.set_value();
+            return rpp::schedulers::optional_duration{};
+        }, obs);
+
+        REQUIRE(wait());
+        REQUIRE(second_done.get_future().wait_for(std::chrono::seconds{5}) == std::future_status::ready);
+        CHECK(first_id != std::this_thread::get_id());
+        CHECK(second_id != std::this_thread::get_id());
+        CHECK(first_id != second_id);
+    }
+
+    SECTION("new_thread scheduler respects to time point and order of scheduling")
+    {
+        std::vector<int> executions{};
+        worker.schedule([&](const auto& obs) -> rpp::schedulers::optional_duration
+        {
+            worker.schedule(std::chrono::milliseconds{20}, [&](const auto&){ executions.push_back(3); done.set_value(); return rpp::schedulers::optional_duration{}; }, obs);
+            worker.schedule(std::chrono::milliseconds{10}, [&](const auto&){ executions.push_back(1); return rpp::schedulers::optional_duration{}; }, obs);
+            worker.schedule(std::chrono::milliseconds{10}, [&](const auto&){ executions.push_back(2); return rpp::schedulers::optional_duration{}; }, obs);
+            return rpp::schedulers::optional_duration{};
+        }, obs);
+
+        REQUIRE(wait());
+        CHECK(executions == std::vector{1, 2, 3});
+    }
+
+    SECTION("new_thread scheduler dispatches schedulables from many threads in order of scheduling per thread")
+    {
+        constexpr int                 producers_count = 4;
+        constexpr int                 per_producer    = 1000;
+        std::vector<std::vector<int>> executions(producers_count);
+        std::atomic_int               remaining{producers_count * per_producer};
+
+        std::vector<std::thread> producers{};
+        for (int p = 0; p < producers_count; ++p)
+        {
+            producers.emplace_back([&, p]
+            {
+                for (int i = 0; i < per_producer; ++i)
+                {
+                    worker.schedule([&, p, i](const auto&)
+                    {
+                        executions[static_cast<size_t>(p)].push_back(i);
+                        if (--remaining == 0)
+                            done.set_value();
+                        return rpp::schedulers::optional_duration{};
+                    }, obs);
+                }
+            });
+        }
+        for (auto& t : producers)
+            t.join();
+
+        REQUIRE(wait());
+        for (const auto& e : executions)
+        {
+            REQUIRE(e.size() == per_producer);
+            CHECK(std::is_sorted(e.begin(), e.end()));
+        }
+    }
+
+    SECTION("new_thread scheduler does not dispatch schedulables after disposing of worker")
+    {
+        std::atomic_size_t call_count{};
+        worker.schedule(std::chrono::milliseconds{10}, [&](const auto&) { ++call_count; return rpp::schedulers::optional_duration{}; }, obs);
+        worker.get_disposable().dispose();
+        worker.schedule([&](const auto&) { ++call_count; return rpp::schedulers::optional_duration{}; }, obs);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds{50});
+        CHECK(call_count == 0);
+    }
+
+    SECTION("new_thread scheduler finishes thread when worker destroyed and all schedulables dispatched")
+    {
+        std::weak_ptr<rpp::base_disposable> queue{};
+        std::atomic_size_t                  call_count{};
+        {
+            const auto local_worker = rpp::schedulers::new_thread::create_worker();
+            queue                   = local_worker.get_disposable().get_original();
+            local_worker.schedule(std::chrono::milliseconds{10}, [&](const auto&) -> rpp::schedulers::optional_duration
+            {
+                if (++call_count < 3)
+                    return std::chrono::milliseconds{1};
+                return std::nullopt;
+            }, obs);
+        }
+
+        const auto deadline = rpp::schedulers::clock_type::now() + std::chrono::seconds{5};
+        while (!queue.expired() && rpp::schedulers::clock_type::now() < deadline)
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+
+        CHECK(queue.expired());
+        CHECK(call_count == 3);
+    }
+}
+
+TEST_CASE("run_loop scheduler")
+{
+    auto d   = rpp::disposable_wrapper{std::make_shared<rpp::base_disposable>()};
+    auto obs = rpp::make_lambda_observer(d, [](int){ }).as_dynamic();
+
+    rpp::schedulers::run_loop loop{};
+    auto                      worker = loop.create_worker();
+    CHECK(loop.is_empty());
+
+    std::vector<int> executions{};
+
+    SECTION("run_loop scheduler dispatches schedulables only from dispatch calls")
+    {
+        worker.schedule([&](const auto&) { executions.push_back(1); return rpp::schedulers::optional_duration{}; }, obs);
+        worker.schedule([&](const auto&) { executions.push_back(2); return rpp::schedulers::optional_duration{}; }, obs);
+        CHECK(executions.empty());
+        CHECK(!loop.is_empty());
+
+        CHECK(loop.dispatch_if_ready());
+        CHECK(executions == std::vector{1});
+
+        loop.dispatch();
+        CHECK(executions == std::vector{1, 2});
+        CHECK(loop.is_empty());
+        CHECK(!loop.dispatch_if_ready());
+    }
+
+    SECTION("run_loop scheduler re-schedules action at provided timepoint")
+    {
+        const auto diff = std::chrono::milliseconds{50};
+        worker.schedule([&](const auto&) -> rpp::schedulers::optional_duration
+        {
+            executions.push_back(static_cast<int>(executions.size()));
+            if (executions.size() < 2)
+                return diff;
+            return std::nullopt;
+        }, obs);
+
+        CHECK(loop.dispatch_if_ready());
+        CHECK(!loop.dispatch_if_ready());
+        CHECK(!loop.is_empty());
+
+        const auto now = rpp::schedulers::clock_type::now();
+        loop.dispatch();
+        CHECK(rpp::schedulers::clock_type::now() - now >= diff - std::chrono::milliseconds{1});
+        CHECK(executions == std::vector{0, 1});
+        CHECK(loop.is_empty());
+    }
+
+    SECTION("run_loop scheduler dispatches schedulables scheduled from another thread")
+    {
+        std::thread thread{[&]
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+            worker.schedule([&](const auto&) { executions.push_back(1); return rpp::schedulers::optional_duration{}; }, obs);
+        }};
+
+        loop.dispatch();
+        thread.join();
+        CHECK(executions == std::vector{1});
+    }
+
+    SECTION("run_loop scheduler removes pending schedulables of worker on disposing of worker")
+    {
+        auto arg   = std::make_shared<int>();
+        auto other = loop.create_worker();
+        worker.schedule(std::chrono::hours{1}, [](const auto&, const std::shared_ptr<int>&) { return rpp::schedulers::optional_duration{}; }, obs, arg);
+        other.schedule([&](const auto&) { executions.push_back(1); return rpp::schedulers::optional_duration{}; }, obs);
+        CHECK(arg.use_count() == 2);
+
+        worker.get_disposable().dispose();
+        CHECK(arg.use_count() == 1);
+
+        worker.schedule([&](const auto&) { executions.push_back(2); return rpp::schedulers::optional_duration{}; }, obs);
+        while (loop.dispatch_if_ready()) {}
+        CHECK(executions == std::vector{1});
+        CHECK(loop.is_empty());
+    }
+
+    SECTION("run_loop scheduler does not dispatch schedulable after disposing of observer")
+    {
+        worker.schedule([&](const auto&) { executions.push_back(1); return rpp::schedulers::optional_duration{}; }, obs);
+        d.dispose();
+
+        while (loop.dispatch_if_ready()) {}
+        CHECK(executions.empty());
+        CHECK(loop.is_empty());
+    }
+}
+
+TEST_CASE("thread_pool scheduler")
+{
+    auto d   = rpp::disposable_wrapper{std::make_shared<rpp::base_disposable>()};
+    auto obs = rpp::make_lambda_observer(d, [](int){ }).as_dynamic();
+
+    rpp::schedulers::thread_pool pool{4};
+    auto                         worker = pool.create_worker();
+    CHECK(!worker.get_disposable().is_disposed());
+
+    std::promise<void> done{};
+    auto               future = done.get_future();
+    const auto         wait   = [&future] { return future.wait_for(std::chrono::seconds{5}) == std::future_status::ready; };
+
+    SECTION("thread_pool scheduler executes schedulables in another thread")
+    {
+        std::thread::id thread_id{};
+        worker.schedule([&](const auto&)
+        {
+            thread_id = std::this_thread::get_id();
+            done.set_value();
+            return rpp::schedulers::optional_duration{};
+        }, obs);
+
+        REQUIRE(wait());
+        CHECK(thread_id != std::this_thread::get_id());
+    }
+
+    SECTION("thread_pool scheduler re-schedules action at provided timepoint")
+    {
+        std::vector<rpp::schedulers::time_point> executions{};
+        const auto                               diff = std::chrono::milliseconds{50};
+        worker.schedule([&](const auto&) -> rpp::schedulers::optional_duration
+        {
+            executions.push_back(rpp::schedulers::clock_type::now());
+            if (executions.size() < 2)
+                return diff;
+            done.set_value();
+            return {};
+        }, obs);
+
+        REQUIRE(wait());
+        REQUIRE(executions.size() == 2);
+        CHECK(executions[1] - executions[0] >= diff);
+    }
+
+    SECTION("thread_pool scheduler respects to time point")
+    {
+        std::vector<int> executions{};
+        worker.schedule([&](const auto& obs) -> rpp::schedulers::optional_duration
+        {
+            worker.schedule(std::chrono::milliseconds{30}, [&](const auto&){ executions.push_back(3); done.set_value(); return rpp::schedulers::optional_duration{}; }, obs);
+            worker.schedule(std::chrono::milliseconds{10}, [&](const auto&){ executions.push_back(1); return rpp::schedulers::optional_duration{}; }, obs);
+            worker.schedule(std::chrono::milliseconds{20}, [&](const auto&){ executions.push_back(2); return rpp::schedulers::optional_duration{}; }, obs);
+            return rpp::schedulers::optional_duration{};
+        }, obs);
+
+        REQUIRE(wait());
+        CHECK(executions == std::vector{1, 2, 3});
+    }
+
+    SECTION("thread_pool scheduler executes schedulables of each worker serially in order of scheduling")
+    {
+        constexpr size_t workers_count = 16;
+        constexpr int    count         = 1000;
+
+        struct worker_state
+        {
+            std::atomic_bool in_progress{};
+            std::vector<int> executions{};
+            bool             overlapped{};
+        };
+
+        std::vector<worker_state> states(workers_count);
+        std::atomic_size_t        finished{};
+        for (size_t i = 0; i < workers_count; ++i)
+        {
+            const auto w = pool.create_worker();
+            for (int v = 0; v < count; ++v)
+            {
+                w.schedule([&, i, v](const auto&)
+                {
+                    auto& state = states[i];
+                    if (state.in_progress.exchange(true))
+                        state.overlapped = true;
+                    state.executions.push_back(v);
+                    state.in_progress.store(false);
+
+                    if (v == count - 1 && ++finished == workers_count)
+                        done.set_value();
+                    return rpp::schedulers::optional_duration{};
+                }, obs);
+            }
+        }
+
+        REQUIRE(wait());
+        for (const auto& state : states)
+        {
+            CHECK(!state.overlapped);
+            REQUIRE(state.executions.size() == count);
+            CHECK(std::is_sorted(state.executions.begin(), state.executions.end()));
+        }
+    }
+
+    SECTION("thread_pool scheduler does not dispatch schedulables after disposing of worker")
+    {
+        std::atomic_size_t call_count{};
+        worker.schedule([&](const auto&)
+        {
+            ++call_count;
+            worker.get_disposable().dispose();
+            worker.schedule([&](const auto&) { ++call_count; return rpp::schedulers::optional_duration{}; }, obs);
+            return rpp::schedulers::optional_duration{std::chrono::nanoseconds{1}};
+        }, obs);
+        worker.schedule(std::chrono::milliseconds{10}, [&](const auto&) { ++call_count; return rpp::schedulers::optional_duration{}; }, obs);
+
+        pool.create_worker().schedule(std::chrono::milliseconds{50}, [&](const auto&) { done.set_value(); return rpp::schedulers::optional_duration{}; }, obs);
+
+        REQUIRE(wait());
+        CHECK(call_count == 1);
+    }
+
+    SECTION("thread_pool scheduler does not dispatch schedulable after disposing of observer")
+    {
+        std::atomic_size_t call_count{};
+        worker.schedule([&](const auto&) -> rpp::schedulers::optional_duration
+        {
+            ++call_count;
+            d.dispose();
+            return std::chrono::nanoseconds{1};
+        }, obs);
+
+        pool.create_worker().schedule(std::chrono::milliseconds{50}, [&](const auto&) { done.set_value(); return rpp::schedulers::optional_duration{}; }, rpp::make_lambda_observer([](int){ }));
+
+        REQUIRE(wait());
+        CHECK(call_count == 1);
+    }
+}
+
+TEST_CASE("virtual_time scheduler")
+{
+    rpp::schedulers::virtual_time scheduler{};
+    const auto                    start  = scheduler.now();
+    auto                          worker = scheduler.create_worker();
+    auto                          obs    = rpp::make_lambda_observer([](int){ }).as_dynamic();
+
+    std::vector<rpp::schedulers::time_point> executions{};
+    const auto                               record = [&](const auto&) { executions.push_back(scheduler.now()); return rpp::schedulers::optional_duration{}; };
+
+    SECTION("virtual_time scheduler executes nothing till advancing of time")
+    {
+        worker.schedule(record, obs);
+        CHECK(executions.empty());
+        CHECK(!scheduler.is_empty());
+
+        scheduler.advance_by(rpp::schedulers::duration{});
+        CHECK(executions == std::vector{start});
+        CHECK(scheduler.is_empty());
+    }
+
+    SECTION("virtual_time scheduler executes delayed schedulables at their virtual time_points without sleeping")
+    {
+        worker.schedule(std::chrono::hours{2}, record, obs);
+        worker.schedule(std::chrono::hours{1}, record, obs);
+        worker.schedule(std::chrono::hours{3}, record, obs);
+
+        const auto real_start = rpp::schedulers::clock_type::now();
+        scheduler.advance_by(std::chrono::hours{2});
+        CHECK(rpp::schedulers::clock_type::now() - real_start < std::chrono::seconds{1});
+
+        CHECK(executions == std::vector{start + std::chrono::hours{1}, start + std::chrono::hours{2}});
+        CHECK(scheduler.now() == start + std::chrono::hours{2});
+
+        scheduler.advance_to(start + std::chrono::hours{10});
+        CHECK(executions.size() == 3);
+        CHECK(executions.back() == start + std::chrono::hours{3});
+        CHECK(scheduler.now() == start + std::chrono::hours{10});
+    }
+
+    SECTION("virtual_time scheduler re-schedules schedulables relative to virtual time")
+    {
+        worker.schedule(std::chrono::seconds{1}, [&](const auto&) -> rpp::schedulers::optional_duration
+        {
+            executions.push_back(scheduler.now());
+            if (executions.size() < 3)
+                return std::chrono::seconds{5};
+            return std::nullopt;
+        }, obs);
+
+        scheduler.advance_by(std::chrono::minutes{1});
+        CHECK(executions == std::vector{start + std::chrono::seconds{1}, start + std::chrono::seconds{6}, start + std::chrono::seconds{11}});
+    }
+
+    SECTION("virtual_time scheduler executes schedulables scheduled during advancing in the same advancing")
+    {
+        worker.schedule(std::chrono::seconds{1}, [&](const auto& obs)
+        {
+            worker.schedule(std::chrono::seconds{1}, record, obs);
+            worker.schedule(std::chrono::seconds{10}, record, obs);
+            return rpp::schedulers::optional_duration{};
+        }, obs);
+
+        scheduler.advance_by(std::chrono::seconds{5});
+        CHECK(executions == std::vector{start + std::chrono::seconds{2}});
+    }
+
+    SECTION("virtual_time scheduler never moves clock backward")
+    {
+        scheduler.advance_by(std::chrono::seconds{5});
+        scheduler.advance_to(start);
+        CHECK(scheduler.now() == start + std::chrono::seconds{5});
+    }
+
+    SECTION("virtual_time scheduler does not execute schedulables of disposed observer")
+    {
+        auto d = rpp::disposable_wrapper{std::make_shared<rpp::base_disposable>()};
+        worker.schedule(std::chrono::seconds{1}, record, rpp::make_lambda_observer(d, [](int){ }));
+        d.dispose();
+
+        scheduler.advance_by(std::chrono::seconds{5});
+        CHECK(executions.empty());
+        CHECK(scheduler.is_empty());
+    }
+
+    SECTION("test_scheduler records schedulings and executions on virtual time")
+    {
+        test_scheduler test{};
+        const auto     test_start = test.now();
+        test.create_worker().schedule(std::chrono::seconds{1}, [](const auto&) -> rpp::schedulers::optional_duration { return std::nullopt; }, obs);
+
+        CHECK(test.get_schedulings() == std::vector{test_start + std::chrono::seconds{1}});
+        CHECK(test.get_executions().empty());
+
+        test.time_advance(std::chrono::seconds{1});
+        CHECK(test.get_executions() == std::vector{test_start + std::chrono::seconds{1}});
+    }
+
+    SECTION("test_scheduler releases pending schedulables together with itself")
+    {
+        auto               token      = std::make_shared<int>();
+        std::weak_ptr<int> weak_token = token;
+        {
+            test_scheduler test{};
+            test.create_worker().schedule(std::chrono::seconds{1}, [token = std::move(token)](const auto&) -> rpp::schedulers::optional_duration { return std::nullopt; }, obs);
+        }
+        CHECK(weak_token.expired());
+    }
+}
+
+TEMPLATE_TEST_CASE("schedulables_queue keeps order of schedulables", "", rpp::schedulers::details::d_ary_heap<4>, rpp::schedulers::details::timing_wheel<>)
+{
+    rpp::schedulers::details::schedulables_queue<TestType> queue{};
+    std::vector<int> executions{};
+
+    const auto now = rpp::schedulers::clock_type::now();
+    const auto emplace = [&](std::chrono::milliseconds delay, int id)
+    {
+        queue.emplace(now + delay,
+                      [&executions, id](const auto&) { executions.push_back(id); return rpp::schedulers::optional_duration{}; },
+                      rpp::make_lambda_observer([](int){}));
+    };
+
+    const auto drain = [&]
+    {
+        while (!queue.is_empty())
+            (*queue.pop())();
+    };
+
+    SECTION("schedulables with different time_points dispatched by time_point")
+    {
+        emplace(std::chrono::milliseconds{3}, 3);
+        emplace(std::chrono::milliseconds{1}, 1);
+        emplace(std::chrono::milliseconds{5}, 5);
+        emplace(std::chrono::milliseconds{2}, 2);
+        emplace(std::chrono::milliseconds{4}, 4);
+        drain();
+
+        CHECK(executions == std::vector{1, 2, 3, 4, 5});
+    }
+
+    SECTION("schedulables with same time_point dispatched in order of emplacing")
+    {
+        for (int i = 0; i < 20; ++i)
+            emplace(std::chrono::milliseconds{i % 2}, i);
+        drain();
+
+        CHECK(executions == std::vector{0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 1, 3, 5, 7, 9, 11, 13, 15, 17, 19});
+    }
+
+    SECTION("re-emplaced schedulable placed after schedulables with same time_point")
+    {
+        emplace(std::chrono::milliseconds{1}, 1);
+        emplace(std::chrono::milliseconds{1}, 2);
+
+        auto first = queue.pop();
+        queue.emplace(now + std::chrono::milliseconds{1}, std::move(first));
+        drain();
+
+        CHECK(executions == std::vector{2, 1});
+    }
+
+    SECTION("schedulables with time_points spread from microseconds to years dispatched by time_point")
+    {
+        std::vector<std::chrono::microseconds> delays{};
+        for (int i = 0; i < 1000; ++i)
+        {
+            // deterministic spread over all levels of timing_wheel including overflow
+            const auto value = static_cast<int64_t>(i) * 7919 % 1000;
+            delays.push_back(std::chrono::microseconds{value} * (int64_t{1} << (i % 41)));
+        }
+
+        // the same pushes and pops applied to ordered set of (delay, index) give expected order
+        std::set<std::pair<std::chrono::microseconds, int>> reference{};
+        std::vector<int>                                    expected{};
+        const auto                                          pop_reference = [&] {
+            expected.push_back(reference.begin()->second);
+            reference.erase(reference.begin());
+        };
+
+        for (int i = 0; i < static_cast<int>(delays.size()); ++i)
+        {
+            queue.emplace(now + delays[static_cast<size_t>(i)],
+                          [&executions, i](const auto&) { executions.push_back(i); return rpp::schedulers::optional_duration{}; },
+                          rpp::make_lambda_observer([](int){}));
+            reference.emplace(delays[static_cast<size_t>(i)], i);
+
+            // interleave pops with pushes to move current position of timing_wheel
+            if (i % 10 == 9)
+            {
+                (*queue.pop())();
+                pop_reference();
+            }
+        }
+        drain();
+        while (!reference.empty())
+            pop_reference();
+
+        CHECK(executions == expected);
+    }
+}
+
+TEST_CASE("timing_wheel erases groups of schedulables")
+{
+    using wheel = rpp::schedulers::details::timing_wheel<>;
+
+    wheel            queue{};
+    wheel::group     first{};
+    wheel::group     second{};
+    auto             arg = std::make_shared<int>();
+
+    const auto now  = rpp::schedulers::clock_type::now();
+    const auto fn   = [](const auto&, const std::shared_ptr<int>&) { return rpp::schedulers::optional_duration{}; };
+    const auto push = [&](std::chrono::milliseconds delay, wheel::group* group) {
+        auto obs = rpp::make_lambda_observer([](int) {});
+        queue.push(rpp::schedulers::details::make_schedulable<std::decay_t<decltype(fn)>, decltype(obs), std::shared_ptr<int>>(now + delay, fn, std::move(obs), arg), group);
+    };
+
+    push(std::chrono::milliseconds{1}, &first);
+    push(std::chrono::hours{1}, &second);
+    push(std::chrono::milliseconds{100}, &first);
+    push(std::chrono::hours{24 * 365 * 5}, &first);
+    push(std::chrono::milliseconds{50}, nullptr);
+    CHECK(arg.use_count() == 6);
+
+    SECTION("erased schedulables destroyed immediately and never popped")
+    {
+        std::vector<rpp::schedulers::details::schedulable_ptr> erased{};
+        queue.erase(first, erased);
+        CHECK(first.is_erased());
+        CHECK(!second.is_erased());
+        CHECK(erased.size() == 3);
+        erased.clear();
+        CHECK(arg.use_count() == 3);
+
+        CHECK(queue.get_top_timepoint() == now + std::chrono::milliseconds{50});
+        auto [top, group] = queue.pop_with_group();
+        CHECK(group == nullptr);
+        std::tie(top, group) = queue.pop_with_group();
+        CHECK(group == &second);
+        CHECK(queue.is_empty());
+    }
+
+    SECTION("schedulable being ready is erased too")
+    {
+        CHECK(queue.get_top_timepoint() == now + std::chrono::milliseconds{1});
+
+        std::vector<rpp::schedulers::details::schedulable_ptr> erased{};
+        queue.erase(first, erased);
+        CHECK(erased.size() == 3);
+
+        CHECK(queue.get_top_timepoint() == now + std::chrono::milliseconds{50});
+        queue.pop();
+        queue.pop();
+        CHECK(queue.is_empty());
+    }
+}
+
+TEST_CASE("mpsc_queue passes schedulables from many producers to one consumer")
+{
+    rpp::schedulers::details::mpsc_queue<int> queue{};
+    auto                                       arg = std::make_shared<int>(1);
+
+    const auto push = [&](int* context)
+    {
+        auto fn  = [](const auto&, const std::shared_ptr<int>&) { return rpp::schedulers::optional_duration{}; };
+        auto obs = rpp::make_lambda_observer([](int) {});
+        queue.push(rpp::schedulers::details::make_schedulable<decltype(fn), decltype(obs), std::shared_ptr<int>>(rpp::schedulers::time_point{}, fn, std::move(obs), arg), context);
+    };
+
+    SECTION("empty queue pops nothing")
+    {
+        CHECK(queue.is_empty());
+        CHECK(queue.pop().first == nullptr);
+    }
+
+    SECTION("schedulables popped in order of pushing with their contexts")
+    {
+        std::array<int, 3> contexts{};
+        for (auto& c : contexts)
+            push(&c);
+        CHECK(!queue.is_empty());
+
+        for (auto& c : contexts)
+        {
+            auto [schedulable, context] = queue.pop();
+            CHECK(schedulable != nullptr);
+            CHECK(context == &c);
+        }
+        CHECK(queue.is_empty());
+        CHECK(arg.use_count() == 1);
+    }
+
+    SECTION("schedulables pushed concurrently are popped exactly once keeping order per producer")
+    {
+        constexpr size_t                       producers_count = 4;
+        constexpr size_t                       per_producer    = 10000;
+        std::array<std::array<int, per_producer>, producers_count> contexts{};
+
+        std::vector<std::thread> producers{};
+        for (size_t p = 0; p < producers_count; ++p)
+        {
+            producers.emplace_back([&, p]
+            {
+                for (auto& c : contexts[p])
+                    push(&c);
+            });
+        }
+
+        std::array<size_t, producers_count> next{};
+        size_t                              popped{};
+        while (popped != producers_count * per_producer)
+        {
+            auto [schedulable, context] = queue.pop();
+            if (!schedulable)
+                continue;
+
+            ++popped;
+            for (size_t p = 0; p < producers_count; ++p)
+            {
+                if (context >= contexts[p].data() && context < contexts[p].data() + per_producer)
+                {
+                    CHECK(context == &contexts[p][next[p]]);
+                    ++next[p];
+                }
+            }
+        }
+        for (auto& t : producers)
+            t.join();
+
+        CHECK(queue.is_empty());
+        CHECK(arg.use_count() == 1);
+    }
+
+    SECTION("schedulables left in queue destroyed with queue")
+    {
+        {
+            rpp::schedulers::details::mpsc_queue<int> local{};
+            auto fn  = [](const auto&, const std::shared_ptr<int>&) { return rpp::schedulers::optional_duration{}; };
+            auto obs = rpp::make_lambda_observer([](int) {});
+            local.push(rpp::schedulers::details::make_schedulable<decltype(fn), decltype(obs), std::shared_ptr<int>>(rpp::schedulers::time_point{}, fn, std::move(obs), arg), nullptr);
+            CHECK(arg.use_count() == 2);
+        }
+        CHECK(arg.use_count() == 1);
+    }
+}
+
+TEST_CASE("schedulables_queue releases schedulables")
+{
+    rpp::schedulers::details::schedulables_queue<> queue{};
+    const auto now = rpp::schedulers::clock_type::now();
+    auto       arg = std::make_shared<int>(1);
+
+    const auto emplace = [&]
+    {
+        queue.emplace(now,
+                      [](const auto&, const std::shared_ptr<int>&) { return rpp::schedulers::optional_duration{}; },
+                      rpp::make_lambda_observer([](int){}),
+                      arg);
+    };
+
+    SECTION("arguments of schedulable destroyed when popped schedulable is destroyed")
+    {
+        emplace();
+        CHECK(arg.use_count() == 2);
+
+        queue.pop().reset();
+        CHECK(arg.use_count() == 1);
+    }
+
+    SECTION("arguments of schedulables destroyed with queue")
+    {
+        for (size_t i = 0; i < 10; ++i)
+            emplace();
+        CHECK(arg.use_count() == 11);
+
+        queue = rpp::schedulers::details::schedulables_queue<>{};
+        CHECK(arg.use_count() == 1);
+    }
+
+    SECTION("memory of destroyed schedulable reused by next one")
+    {
+        emplace();
+        auto        schedulable = queue.pop();
+        const void* address     = schedulable.get();
+        schedulable.reset();
+
+        emplace();
+        CHECK(queue.pop().get() == address);
+    }
+}
@@ -0,0 +1,135 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <snitch/snitch.hpp>
+
+#include <rpp/observers/lambda_observer.hpp>
+#include <rpp/operators/subscribe_on.hpp>
+#include <rpp/operators/take.hpp>
+#include <rpp/schedulers/immediate.hpp>
+#include <rpp/schedulers/new_thread.hpp>
+#include <rpp/schedulers/run_loop.hpp>
+#include <rpp/schedulers/thread_pool.hpp>
+#include <rpp/sources/create.hpp>
+#include <rpp/sources/from.hpp>
+
+#include "mock_observer.hpp"
+
+#include <atomic>
+#include <future>
+#include <optional>
+#include <thread>
+#include <vector>
+
+TEST_CASE("subscribe_on schedules subscription via scheduler")
+{
+    auto                      mock = mock_observer_strategy<int>();
+    rpp::schedulers::run_loop loop{};
+
+    size_t subscribe_count{};
+    auto   observable = rpp::source::create<int>([&subscribe_count](const auto& obs) {
+        ++subscribe_count;
+        obs.on_next(1);
+        obs.on_next(2);
+        obs.on_completed();
+    });
+
+    SECTION("subscription happens only when scheduler executes schedulable")
+    {
+        observable | rpp::operators::subscribe_on(loop) | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(subscribe_count == 0u);
+        CHECK(mock.get_total_on_next_count() == 0u);
+
+        while (loop.dispatch_if_ready()) {}
+
+        CHECK(subscribe_count == 1u);
+        CHECK(mock.get_received_values() == std::vector{1, 2});
+        CHECK(mock.get_on_completed_count() == 1u);
+    }
+
+    SECTION("disposing of observer before scheduled subscription cancels it")
+    {
+        auto   disposable = std::make_shared<rpp::base_disposable>();
+        size_t on_next_count{};
+        observable | rpp::operators::subscribe_on(loop) | rpp::operators::subscribe(rpp::make_lambda_observer<int>(rpp::disposable_wrapper{disposable}, [&](int) { ++on_next_count; }, [](const std::exception_ptr&) {}, []() {}));
+
+        disposable->dispose();
+        while (loop.dispatch_if_ready()) {}
+
+        CHECK(subscribe_count == 0u);
+        CHECK(on_next_count == 0u);
+        CHECK(loop.is_empty());
+    }
+
+    SECTION("emissions after subscription are not affected by scheduler")
+    {
+        std::optional<rpp::dynamic_observer<int>> source_observer{};
+        rpp::source::create<int>([&](auto&& obs) { source_observer.emplace(std::forward<decltype(obs)>(obs).as_dynamic()); })
+            | rpp::operators::subscribe_on(loop)
+            | rpp::operators::take(1)
+            | rpp::operators::subscribe(mock.get_observer());
+
+        while (loop.dispatch_if_ready()) {}
+        REQUIRE(source_observer.has_value());
+
+        source_observer->on_next(5);
+        CHECK(mock.get_received_values() == std::vector{5});
+        CHECK(mock.get_on_completed_count() == 1u);
+        CHECK(source_observer->is_disposed());
+    }
+}
+
+TEST_CASE("subscribe_on with immediate subscribes in place")
+{
+    auto mock = mock_observer_strategy<int>();
+
+    rpp::source::just(rpp::schedulers::immediate{}, 1, 2, 3) | rpp::operators::subscribe_on(rpp::schedulers::immediate{}) | rpp::operators::subscribe(mock.get_observer());
+
+    CHECK(mock.get_received_values() == std::vector{1, 2, 3});
+    CHECK(mock.get_on_completed_count() == 1u);
+}
+
+TEST_CASE("subscribe_on with new_thread subscribes on another thread")
+{
+    std::promise<std::thread::id> subscribe_thread{};
+
+    rpp::source::create<int>([&](const auto& obs) {
+        subscribe_thread.set_value(std::this_thread::get_id());
+        obs.on_completed();
+    })
+        | rpp::operators::subscribe_on(rpp::schedulers::new_thread{})
+        | rpp::operators::subscribe([](int) {});
+
+    CHECK(subscribe_thread.get_future().get() != std::this_thread::get_id());
+}
+
+TEST_CASE("subscribe_on with thread_pool subscribes independent pipelines")
+{
+    constexpr size_t             count = 16;
+    rpp::schedulers::thread_pool pool{2};
+
+    std::atomic<size_t> completed{};
+    std::promise<void>  all_completed{};
+    for (size_t i = 0; i < count; ++i)
+    {
+        rpp::source::just(rpp::schedulers::immediate{}, 1)
+            | rpp::operators::subscribe_on(pool)
+            | rpp::operators::subscribe([](int) {},
+                                        [](const std::exception_ptr&) {},
+                                        [&] {
+                                            if (completed.fetch_add(1) + 1 == count)
+                                                all_completed.set_value();
+                                        });
+    }
+
+    all_completed.get_future().wait();
+    CHECK(completed.load() == count);
+}
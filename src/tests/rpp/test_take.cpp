@@ -91,4 +91,34 @@ TEST_CASE("take operator forwards on_error")
     CHECK(mock.get_received_values() == std::vector<int>{});
     CHECK(mock.get_on_error_count() == 1);
     CHECK(mock.get_on_completed_count() == 0);
-}
\ No newline at end of file
+}
+
+TEST_CASE("take operator limits batch of emissions")
+{
+    batch_mock_observer_strategy<int> mock{};
+    auto obs = rpp::source::create<int>([](const auto& obs)
+    {
+        const std::vector<int> values{0, 1, 2, 3, 4};
+        obs.on_next_batch(values);
+        obs.on_next_batch(values);
+        obs.on_completed();
+    });
+
+    SECTION("take(3) passes part of batch")
+    {
+        obs | rpp::operators::take(3) | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(mock.get_batches_count() == 1u);
+        CHECK(mock.get_mock().get_received_values() == std::vector{0, 1, 2});
+        CHECK(mock.get_mock().get_on_completed_count() == 1u);
+    }
+
+    SECTION("take(7) passes parts of several batches")
+    {
+        obs | rpp::operators::take(7) | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(mock.get_batches_count() == 2u);
+        CHECK(mock.get_mock().get_received_values() == std::vector{0, 1, 2, 3, 4, 0, 1});
+        CHECK(mock.get_mock().get_on_completed_count() == 1u);
+    }
+}
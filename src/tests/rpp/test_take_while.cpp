@@ -10,12 +10,16 @@
 
 #include "mock_observer.hpp"
 
+#include <rpp/operators/take.hpp>
 #include <rpp/operators/take_while.hpp>
+#include <rpp/schedulers/immediate.hpp>
 #include <rpp/sources/create.hpp>
+#include <rpp/sources/from.hpp>
 #include <snitch/snitch.hpp>
 
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 TEST_CASE("take_while")
 {
@@ -42,4 +46,69 @@ TEST_CASE("take_while")
 
         CHECK(mock.get_received_values().empty());
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("take_while with batch of emissions")
+{
+    batch_mock_observer_strategy<int> mock{};
+    auto obs = rpp::source::create<int>([](const auto& obs)
+    {
+        const std::vector<int> values{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+        obs.on_next_batch(values);
+        obs.on_completed();
+    });
+
+    SECTION("take while val <= 5 passes prefix of batch and completes")
+    {
+        obs | rpp::operators::take_while([](int val) { return val <= 5; }) | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(mock.get_batches_count() == 1u);
+        CHECK(mock.get_mock().get_received_values() == std::vector{0, 1, 2, 3, 4, 5});
+        CHECK(mock.get_mock().get_on_completed_count() == 1u);
+    }
+
+    SECTION("take while false passes nothing")
+    {
+        obs | rpp::operators::take_while([](int) { return false; }) | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(mock.get_batches_count() == 0u);
+        CHECK(mock.get_mock().get_on_completed_count() == 1u);
+    }
+}
+
+TEST_CASE("take_while invokes predicate for batch of emissions the same way as for separate emissions")
+{
+    const std::vector<int> values{0, 1, 2, 3, 4, 5, 6, 7};
+
+    auto   mock = mock_observer_strategy<int>();
+    size_t calls{};
+
+    SECTION("predicate is invoked only for values accepted by take")
+    {
+        rpp::source::from_iterable(values, rpp::schedulers::immediate{})
+            | rpp::operators::take_while([&calls](int) { ++calls; return true; })
+            | rpp::operators::take(2)
+            | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(calls == 2u);
+        CHECK(mock.get_received_values() == std::vector{0, 1});
+        CHECK(mock.get_on_completed_count() == 1u);
+    }
+
+    SECTION("values satisfied before exception are passed before error")
+    {
+        rpp::source::from_iterable(values, rpp::schedulers::immediate{})
+            | rpp::operators::take_while([&calls](int v) {
+                  ++calls;
+                  if (v == 2)
+                      throw std::runtime_error{""};
+                  return true;
+              })
+            | rpp::operators::subscribe(mock.get_observer());
+
+        CHECK(calls == 3u);
+        CHECK(mock.get_received_values() == std::vector{0, 1});
+        CHECK(mock.get_on_error_count() == 1u);
+        CHECK(mock.get_on_completed_count() == 0u);
+    }
+}
@@ -0,0 +1,41 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+
+class counting_memory_resource final : public std::pmr::memory_resource
+{
+public:
+    size_t get_allocations_count() const { return m_allocations_count; }
+    size_t get_deallocations_count() const { return m_deallocations_count; }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        ++m_allocations_count;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override
+    {
+        ++m_deallocations_count;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+private:
+    std::atomic<size_t> m_allocations_count{};
+    std::atomic<size_t> m_deallocations_count{};
+};
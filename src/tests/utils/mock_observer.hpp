@@ -13,6 +13,7 @@
 #include "rpp/disposables/fwd.hpp"
 #include <rpp/observers/base_observer.hpp>
 
+#include <span>
 #include <vector>
 
 template<typename Type>
@@ -68,3 +69,36 @@ private:
 
     std::shared_ptr<State> m_state{};
 };
+
+/**
+ * @brief Same as mock_observer_strategy, but handles batches of values natively and tracks amount of obtained batches
+ */
+template<typename Type>
+class batch_mock_observer_strategy final
+{
+public:
+    void on_next(const Type& v) const noexcept { m_mock.on_next(v); }
+    void on_next(Type&& v) const noexcept { m_mock.on_next(std::move(v)); }
+
+    void on_next_batch(std::span<const Type> values) const noexcept
+    {
+        ++*m_batches_count;
+        for (const auto& v : values)
+            m_mock.on_next(v);
+    }
+
+    void on_error(const std::exception_ptr& err) const noexcept { m_mock.on_error(err); }
+    void on_completed() const noexcept { m_mock.on_completed(); }
+
+    static bool is_disposed() noexcept { return false; }
+    static void set_upstream(const rpp::disposable_wrapper&) noexcept {}
+
+    size_t get_batches_count() const { return *m_batches_count; }
+    const mock_observer_strategy<Type>& get_mock() const { return m_mock; }
+
+    auto get_observer() const {return rpp::base_observer<Type, batch_mock_observer_strategy<Type>>{*this}; }
+
+private:
+    mock_observer_strategy<Type> m_mock{};
+    std::shared_ptr<size_t>      m_batches_count = std::make_shared<size_t>();
+};
@@ -0,0 +1,36 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/observers/dynamic_observer.hpp>
+#include <rpp/sources/create.hpp>
+
+#include <memory>
+#include <optional>
+#include <utility>
+
+/**
+ * @brief Observable which saves subscribed observer to let test emit values manually at any moment.
+ */
+template<typename Type>
+struct observable_with_saved_observer
+{
+    std::shared_ptr<std::optional<rpp::dynamic_observer<Type>>> observer = std::make_shared<std::optional<rpp::dynamic_observer<Type>>>();
+
+    auto get_observable() const
+    {
+        return rpp::source::create<Type>([saved = observer](auto&& obs) { saved->emplace(std::forward<decltype(obs)>(obs).as_dynamic()); });
+    }
+
+    bool is_subscribed() const { return observer->has_value(); }
+
+    const rpp::dynamic_observer<Type>* operator->() const { return &observer->value(); }
+};
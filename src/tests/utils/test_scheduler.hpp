@@ -11,91 +11,61 @@
 
 #include <rpp/schedulers.hpp>
 
-static rpp::schedulers::time_point s_current_time{std::chrono::seconds{10}};
+#include <memory>
+#include <vector>
 
-class test_scheduler final : public rpp::schedulers::details::scheduler_tag
+/**
+ * @brief rpp::schedulers::virtual_time which additionally records time_points of schedulings and executions of schedulables
+ */
+class test_scheduler final
 {
-public:
     struct state
     {
-        state() = default;
-
-        void schedule(rpp::schedulers::time_point                        time_point,
-                      rpp::schedulers::constraint::schedulable_fn auto&& fn)
-        {
-            if (!sub.is_subscribed())
-                return;
-
-            schedulings.push_back(time_point);
-            queue.emplace(time_point,
-                          static_cast<size_t>(rpp::schedulers::clock_type::now().time_since_epoch().count()),
-                          std::forward<decltype(fn)>(fn));
-        }
-
-        void drain()
-        {
-            while (!queue.empty() && sub.is_subscribed())
-            {
-                auto time_point = queue.top().get_time_point();
-                if (time_point > s_current_time)
-                    return;
-
-                auto fn = queue.top().extract_function();
-                queue.pop();
-
-                executions.push_back(s_current_time);
-                if (auto duration = fn())
-                    schedule(std::max(s_current_time, time_point + duration.value()), std::move(fn));
-            }
-        }
-
-        rpp::subscription_base                   sub{};
+        rpp::schedulers::virtual_time            scheduler{rpp::schedulers::time_point{std::chrono::seconds{10}}};
         std::vector<rpp::schedulers::time_point> schedulings{};
         std::vector<rpp::schedulers::time_point> executions{};
-        std::priority_queue<rpp::schedulers::details::schedulable<std::function<rpp::schedulers::optional_duration()>>> queue{};
     };
 
+public:
     class worker_strategy
     {
     public:
-        worker_strategy(std::weak_ptr<state> state)
-            : m_state{state} { }
+        explicit worker_strategy(std::shared_ptr<state> state)
+            : m_state{std::move(state)} {}
 
-        void defer_at(rpp::schedulers::time_point                        time_point,
-                      rpp::schedulers::constraint::schedulable_fn auto&& fn) const
+        template<rpp::constraint::observer TObs, typename... Args, rpp::schedulers::constraint::schedulable_fn<TObs, Args...> Fn>
+        void defer_for(rpp::schedulers::duration duration, Fn&& fn, TObs&& obs, Args&&... args) const
         {
-            if (auto locked = m_state.lock())
-            {
-                if (locked->sub.is_subscribed())
-                {
-                    locked->schedule(time_point, std::forward<decltype(fn)>(fn));
-                    locked->drain();
-                }
-            }
+            m_state->schedulings.push_back(m_state->scheduler.now() + duration);
+            // schedulable is stored in queue owned by state, so raw pointer is enough and doesn't keep state alive via itself
+            m_worker.schedule(duration,
+                              [state = m_state.get(), fn = std::forward<Fn>(fn)](auto& obs, auto&... args) mutable -> rpp::schedulers::optional_duration
+                              {
+                                  state->executions.push_back(state->scheduler.now());
+                                  return fn(obs, args...);
+                              },
+                              std::forward<TObs>(obs),
+                              std::forward<Args>(args)...);
         }
 
-        static rpp::schedulers::time_point now() { return s_current_time; }
+        static rpp::disposable_wrapper get_disposable() { return rpp::disposable_wrapper{}; }
 
     private:
-        std::weak_ptr<state> m_state;
+        std::shared_ptr<state>                                                              m_state;
+        rpp::schedulers::worker<rpp::schedulers::virtual_time::worker_strategy> m_worker = m_state->scheduler.create_worker();
     };
 
-    test_scheduler() {}
-
-    rpp::schedulers::worker<worker_strategy> create_worker(const rpp::subscription_base& sub = {}) const
+    rpp::schedulers::worker<worker_strategy> create_worker() const
     {
-        m_state->sub = sub;
         return rpp::schedulers::worker<worker_strategy>{m_state};
     }
 
+    rpp::schedulers::time_point now() const { return m_state->scheduler.now(); }
+
     const auto& get_schedulings() const { return m_state->schedulings; }
     const auto& get_executions() const { return m_state->executions; }
 
-    void time_advance(rpp::schedulers::duration dur) const
-    {
-        s_current_time += dur;
-        m_state->drain();
-    }
+    void time_advance(rpp::schedulers::duration dur) const { m_state->scheduler.advance_by(dur); }
 
 private:
     std::shared_ptr<state> m_state = std::make_shared<state>();